@@ -0,0 +1,78 @@
+#include <QCoreApplication>
+#include <QSharedMemory>
+#include <QStringList>
+
+#include "parser/DumpCsParser.h"
+#include "parser/ModelCache.h"
+
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <string>
+
+// Parses a dump in its own process and publishes the model as a ModelCache image in a shared-memory segment, so
+// parse-time allocations never land in the explorer's heap and a parser crash only takes this process down.
+//
+//   DumpCsParseHelper <segment key> <dump path> [--defer] [--include PATTERN]... [--exclude PATTERN]...
+//
+// Writes "progress N" lines to stdout, then "ready BYTES" once the segment is filled (or "error MESSAGE"), and
+// keeps the segment alive until stdin is closed.
+
+static void emitLine(std::string line) {
+    for (char& c : line) {
+        if (c == '\n' || c == '\r')
+            c = ' ';
+    }
+    line += '\n';
+    std::fputs(line.c_str(), stdout);
+    std::fflush(stdout);
+}
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+    const QStringList args = QCoreApplication::arguments();
+    if (args.size() < 3) {
+        std::fprintf(stderr, "usage: DumpCsParseHelper <segment key> <dump path> [--defer] [--include PATTERN]... [--exclude PATTERN]...\n");
+        return 2;
+    }
+
+    ParseOptions options;
+    for (int i = 3; i < args.size(); ++i) {
+        if (args[i] == "--defer")
+            options.deferSignatures = true;
+        else if (args[i] == "--include" && i + 1 < args.size())
+            options.assemblies.include.push_back(args[++i].toStdString());
+        else if (args[i] == "--exclude" && i + 1 < args.size())
+            options.assemblies.exclude.push_back(args[++i].toStdString());
+    }
+    options.progress = [](int pct) { emitLine("progress " + std::to_string(pct)); };
+
+    const std::string path = args[2].toStdString();
+    ModelCacheKey key;
+    if (!ModelCache::makeKey(path, key)) {
+        emitLine("error Cannot open " + path);
+        return 1;
+    }
+
+    DumpModel model;
+    try {
+        model = DumpCsParser::parse(path, options);
+    } catch (const std::exception& ex) {
+        emitLine(std::string("error ") + ex.what());
+        return 1;
+    }
+
+    const uint64_t bytes = ModelCache::imageSize(key, model);
+    QSharedMemory segment(args[1]);
+    if (!segment.create((qsizetype)bytes)) {
+        emitLine("error " + segment.errorString().toStdString());
+        return 1;
+    }
+    ModelCache::writeImage(static_cast<char*>(segment.data()), key, model);
+    model = DumpModel{};
+    emitLine("ready " + std::to_string(bytes));
+
+    std::string line;
+    while (std::getline(std::cin, line)) {}
+    return 0;
+}
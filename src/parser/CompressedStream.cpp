@@ -0,0 +1,178 @@
+#include "CompressedStream.h"
+
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+#include <string>
+
+#ifdef DUMPCS_HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef DUMPCS_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+struct CompressedStream::Impl {
+    Compression kind = Compression::None;
+    bool finished = false;
+#ifdef DUMPCS_HAVE_ZLIB
+    z_stream zs{};
+    bool zsReady = false;
+    bool zsMemberDone = false;
+#endif
+#ifdef DUMPCS_HAVE_ZSTD
+    ZSTD_DStream* zds = nullptr;
+    size_t zstdHint = 0;
+#endif
+
+    ~Impl() {
+#ifdef DUMPCS_HAVE_ZLIB
+        if (zsReady)
+            inflateEnd(&zs);
+#endif
+#ifdef DUMPCS_HAVE_ZSTD
+        if (zds)
+            ZSTD_freeDStream(zds);
+#endif
+    }
+};
+
+CompressedStream::CompressedStream() : impl_(std::make_unique<Impl>()) {}
+
+CompressedStream::~CompressedStream() = default;
+
+Compression CompressedStream::detect(std::string_view head) {
+    if (head.size() >= 2 && (unsigned char)head[0] == 0x1F && (unsigned char)head[1] == 0x8B)
+        return Compression::Gzip;
+    if (head.size() >= 4 && (unsigned char)head[0] == 0x28 && (unsigned char)head[1] == 0xB5 &&
+        (unsigned char)head[2] == 0x2F && (unsigned char)head[3] == 0xFD)
+        return Compression::Zstd;
+    return Compression::None;
+}
+
+bool CompressedStream::isSupported(Compression kind) {
+    switch (kind) {
+    case Compression::None: return true;
+#ifdef DUMPCS_HAVE_ZLIB
+    case Compression::Gzip: return true;
+#endif
+#ifdef DUMPCS_HAVE_ZSTD
+    case Compression::Zstd: return true;
+#endif
+    default: return false;
+    }
+}
+
+const char* CompressedStream::name(Compression kind) {
+    switch (kind) {
+    case Compression::Gzip: return "gzip";
+    case Compression::Zstd: return "zstd";
+    default: return "uncompressed";
+    }
+}
+
+void CompressedStream::open(std::string_view compressed, Compression kind) {
+    if (!isSupported(kind))
+        throw std::runtime_error(std::string("This build cannot read ") + name(kind) + "-compressed dumps");
+
+    impl_ = std::make_unique<Impl>();
+    impl_->kind = kind;
+    input_ = compressed;
+    consumed_ = 0;
+
+#ifdef DUMPCS_HAVE_ZLIB
+    if (kind == Compression::Gzip) {
+        // 15 + 32: maximum window, gzip or zlib header detected automatically.
+        if (inflateInit2(&impl_->zs, 15 + 32) != Z_OK)
+            throw std::runtime_error("Failed to initialise gzip decoder");
+        impl_->zsReady = true;
+    }
+#endif
+#ifdef DUMPCS_HAVE_ZSTD
+    if (kind == Compression::Zstd) {
+        impl_->zds = ZSTD_createDStream();
+        if (!impl_->zds)
+            throw std::runtime_error("Failed to initialise zstd decoder");
+        impl_->zstdHint = ZSTD_initDStream(impl_->zds);
+    }
+#endif
+}
+
+size_t CompressedStream::read(char* dst, size_t cap) {
+    Impl& d = *impl_;
+    if (d.finished || cap == 0)
+        return 0;
+
+    if (d.kind == Compression::None) {
+        const size_t n = std::min(cap, input_.size() - consumed_);
+        std::copy_n(input_.data() + consumed_, n, dst);
+        consumed_ += n;
+        d.finished = consumed_ == input_.size();
+        return n;
+    }
+
+#ifdef DUMPCS_HAVE_ZLIB
+    if (d.kind == Compression::Gzip) {
+        size_t written = 0;
+        while (written < cap) {
+            if (d.zsMemberDone) {
+                // Concatenated members (e.g. from pigz or appended archives) continue after a reset.
+                if (consumed_ == input_.size()) {
+                    d.finished = true;
+                    break;
+                }
+                inflateReset(&d.zs);
+                d.zsMemberDone = false;
+            }
+
+            d.zs.next_in = (Bytef*)(input_.data() + consumed_);
+            d.zs.avail_in = (uInt)std::min<size_t>(input_.size() - consumed_, UINT_MAX);
+            d.zs.next_out = (Bytef*)(dst + written);
+            d.zs.avail_out = (uInt)std::min<size_t>(cap - written, UINT_MAX);
+            const uInt inBefore = d.zs.avail_in;
+            const uInt outBefore = d.zs.avail_out;
+
+            const int rc = inflate(&d.zs, Z_NO_FLUSH);
+            consumed_ += inBefore - d.zs.avail_in;
+            written += outBefore - d.zs.avail_out;
+
+            if (rc == Z_STREAM_END) {
+                d.zsMemberDone = true;
+                continue;
+            }
+            if (rc == Z_BUF_ERROR && consumed_ == input_.size())
+                throw std::runtime_error("Truncated gzip stream");
+            if (rc != Z_OK && rc != Z_BUF_ERROR)
+                throw std::runtime_error(std::string("Corrupt gzip stream: ") + (d.zs.msg ? d.zs.msg : "inflate failed"));
+        }
+        return written;
+    }
+#endif
+
+#ifdef DUMPCS_HAVE_ZSTD
+    if (d.kind == Compression::Zstd) {
+        ZSTD_outBuffer out{dst, cap, 0};
+        while (out.pos < out.size) {
+            ZSTD_inBuffer in{input_.data() + consumed_, input_.size() - consumed_, 0};
+            const size_t outBefore = out.pos;
+            const size_t rc = ZSTD_decompressStream(d.zds, &out, &in);
+            consumed_ += in.pos;
+            if (ZSTD_isError(rc))
+                throw std::runtime_error(std::string("Corrupt zstd stream: ") + ZSTD_getErrorName(rc));
+
+            if (in.pos > 0 || out.pos > outBefore) {
+                d.zstdHint = rc;
+                continue;
+            }
+            // No progress: either every frame ended cleanly or the input stops mid-frame.
+            if (consumed_ < input_.size() || d.zstdHint != 0)
+                throw std::runtime_error("Truncated zstd stream");
+            d.finished = true;
+            break;
+        }
+        return out.pos;
+    }
+#endif
+
+    return 0;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <string_view>
+#include <memory>
+#include <cstddef>
+
+enum class Compression {
+    None,
+    Gzip,
+    Zstd
+};
+
+class CompressedStream {
+public:
+    CompressedStream();
+    ~CompressedStream();
+
+    CompressedStream(const CompressedStream&) = delete;
+    CompressedStream& operator=(const CompressedStream&) = delete;
+
+    static Compression detect(std::string_view head);
+    static bool isSupported(Compression kind);
+    static const char* name(Compression kind);
+
+    // Decodes from an in-memory (usually mapped) compressed image; throws std::runtime_error on unsupported formats.
+    void open(std::string_view compressed, Compression kind);
+
+    // Fills up to cap bytes; returns 0 once the stream is exhausted. Throws std::runtime_error on corrupt input.
+    size_t read(char* dst, size_t cap);
+
+    size_t consumed() const { return consumed_; }
+    size_t compressedSize() const { return input_.size(); }
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+    std::string_view input_;
+    size_t consumed_ = 0;
+};
@@ -1,33 +1,48 @@
 #include "DumpCsParser.h"
 
+#include "CompressedStream.h"
+#include "MappedFile.h"
+#include "ScanKernels.h"
+#include "SignatureCache.h"
+
 #include <fstream>
-#include <sstream>
 #include <algorithm>
-#include <filesystem>
- #include <charconv>
-
-static std::function<void(int)> g_progressCb = nullptr;
-
-void DumpCsParser::setProgressCallback(const std::function<void(int)>& cb) {
-    g_progressCb = cb;
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <string_view>
+#include <thread>
+
+static std::string_view trim(std::string_view s) {
+    const char* e = s.data() + s.size();
+    const char* b = ScanKernels::skipSpace(s.data(), e);
+    if (b == e) return {};
+    return {b, (size_t)(ScanKernels::skipSpaceBack(b, e) - b)};
 }
 
-static std::string trim(const std::string& s) {
-    size_t b = s.find_first_not_of(" \t\r\n");
-    size_t e = s.find_last_not_of(" \t\r\n");
-    if (b == std::string::npos) return {};
-    return s.substr(b, e - b + 1);
+static size_t findNewline(std::string_view text, size_t from) {
+    const char* e = text.data() + text.size();
+    const char* p = ScanKernels::findByte(text.data() + from, e, '\n');
+    return p == e ? std::string_view::npos : (size_t)(p - text.data());
 }
 
-static bool tryParseHex(const std::string& s, uint64_t& out) {
-    out = 0;
-    const char* b = s.data();
+static size_t findHexPrefix(std::string_view s, size_t from = 0) {
     const char* e = s.data() + s.size();
-    auto res = std::from_chars(b, e, out, 16);
-    return res.ec == std::errc() && res.ptr == e;
+    const char* p = ScanKernels::findPair(s.data() + from, e, '0', 'x');
+    return p == e ? std::string_view::npos : (size_t)(p - s.data());
+}
+
+static bool tryParseHex(std::string_view s, uint64_t& out) {
+    return ScanKernels::decodeHex(s.data(), s.size(), out);
 }
 
-static bool tryParseInt(const std::string& s, int& out) {
+static bool tryParseInt(std::string_view s, int& out) {
     out = 0;
     const char* b = s.data();
     const char* e = s.data() + s.size();
@@ -35,123 +50,184 @@ static bool tryParseInt(const std::string& s, int& out) {
     return res.ec == std::errc() && res.ptr == e;
 }
 
-static std::string stripInlineComment(const std::string& s) {
+static std::string_view stripInlineComment(std::string_view s) {
     const auto p = s.find("//");
-    if (p == std::string::npos) return s;
+    if (p == std::string_view::npos) return s;
     return trim(s.substr(0, p));
 }
 
-static bool startsWith(const std::string& s, const char* prefix) {
-    const size_t n = std::char_traits<char>::length(prefix);
-    return s.size() >= n && s.compare(0, n, prefix) == 0;
+static bool tryParseHexLiteralAt(std::string_view s, size_t x, uint64_t& out) {
+    const size_t i = x + 2;
+    const size_t n = ScanKernels::hexRun(s.data() + i, s.data() + s.size());
+    if (n == 0)
+        return false;
+    return tryParseHex(s.substr(i, n), out);
 }
 
-static bool tryExtractFirstHexAfter(const std::string& s, const char* key, uint64_t& out) {
-    const auto p = s.find(key);
-    if (p == std::string::npos)
-        return false;
-    const auto x = s.find("0x", p);
-    if (x == std::string::npos)
+static bool tryExtractFirstHexAt(std::string_view s, size_t keyPos, uint64_t& out) {
+    if (keyPos == std::string_view::npos)
         return false;
-    size_t i = x + 2;
-    size_t j = i;
-    while (j < s.size()) {
-        const char c = s[j];
-        const bool ok = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
-        if (!ok) break;
-        ++j;
-    }
-    if (j == i)
+    const auto x = findHexPrefix(s, keyPos);
+    if (x == std::string_view::npos)
         return false;
-    return tryParseHex(s.substr(i, j - i), out);
+    return tryParseHexLiteralAt(s, x, out);
 }
 
-static bool tryExtractFirstInlineHex(const std::string& s, uint64_t& out) {
-    const auto x = s.find("0x");
-    if (x == std::string::npos)
+static bool tryExtractFirstInlineHex(std::string_view s, uint64_t& out) {
+    const auto x = findHexPrefix(s);
+    if (x == std::string_view::npos)
         return false;
-    size_t i = x + 2;
-    size_t j = i;
-    while (j < s.size()) {
-        const char c = s[j];
-        const bool ok = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
-        if (!ok) break;
-        ++j;
+    return tryParseHexLiteralAt(s, x, out);
+}
+
+enum class Section {
+    None,
+    Methods,
+    Fields,
+    Properties,
+    Events
+};
+
+static constexpr bool isIdentChar(char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+// Keywords found by the line classifier; the type keywords come first, in the order they take precedence.
+enum Keyword : uint8_t {
+    KwClass,
+    KwStruct,
+    KwEnum,
+    KwInterface,
+    KwImage,
+    KwNamespace,
+    KwTypeDefIndex,
+    KwRva,
+    KwOffset,
+    KwVa,
+    KwCount
+};
+
+static constexpr std::string_view kKeywords[KwCount] = {
+    "class", "struct", "enum", "interface", "Image", "Namespace:", "TypeDefIndex:", "RVA:", "Offset:", "VA:"
+};
+
+// Aho-Corasick automaton over kKeywords, byte-indexed so each step is one table load. States that end a keyword
+// are numbered last, so the scan loop needs a single compare per byte to know whether anything matched.
+struct KeywordAutomaton {
+    static constexpr size_t kMaxStates = 72;
+
+    uint8_t next[kMaxStates][256] = {};
+    uint16_t matches[kMaxStates] = {};
+    size_t states = 1;
+    size_t firstMatch = kMaxStates;
+};
+
+static constexpr KeywordAutomaton buildKeywordAutomaton() {
+    KeywordAutomaton a;
+
+    // Trie first; the root is never a child, so 0 also means "no edge yet".
+    for (size_t k = 0; k < KwCount; ++k) {
+        size_t state = 0;
+        for (const char c : kKeywords[k]) {
+            uint8_t& edge = a.next[state][(uint8_t)c];
+            if (edge == 0)
+                edge = (uint8_t)a.states++;
+            state = edge;
+        }
+        a.matches[state] |= (uint16_t)(1u << k);
     }
-    if (j == i)
-        return false;
-    return tryParseHex(s.substr(i, j - i), out);
+
+    // Breadth-first, so a state's failure target is complete before the state borrows its missing edges and
+    // matches from it ("VA:" also ends every "RVA:").
+    size_t fail[KeywordAutomaton::kMaxStates] = {};
+    size_t queue[KeywordAutomaton::kMaxStates] = {};
+    size_t head = 0;
+    size_t tail = 0;
+    for (size_t c = 0; c < 256; ++c) {
+        if (a.next[0][c] != 0)
+            queue[tail++] = a.next[0][c];
+    }
+    while (head < tail) {
+        const size_t state = queue[head++];
+        a.matches[state] |= a.matches[fail[state]];
+        for (size_t c = 0; c < 256; ++c) {
+            const size_t child = a.next[state][c];
+            if (child != 0) {
+                fail[child] = a.next[fail[state]][c];
+                queue[tail++] = child;
+            } else {
+                a.next[state][c] = a.next[fail[state]][c];
+            }
+        }
+    }
+
+    uint8_t order[KeywordAutomaton::kMaxStates] = {};
+    size_t n = 0;
+    for (size_t state = 0; state < a.states; ++state) {
+        if (a.matches[state] == 0)
+            order[state] = (uint8_t)n++;
+    }
+    KeywordAutomaton out;
+    out.states = a.states;
+    out.firstMatch = n;
+    for (size_t state = 0; state < a.states; ++state) {
+        if (a.matches[state] != 0)
+            order[state] = (uint8_t)n++;
+    }
+    for (size_t state = 0; state < a.states; ++state) {
+        out.matches[order[state]] = a.matches[state];
+        for (size_t c = 0; c < 256; ++c)
+            out.next[order[state]][c] = order[a.next[state][c]];
+    }
+    return out;
 }
 
-static bool tryParseImageLine(const std::string& s, std::string& assemblyOut, int& baseTypeDefIndexOut) {
-    if (!startsWith(s, "//"))
-        return false;
-    if (s.find("Image") == std::string::npos)
-        return false;
+static constexpr KeywordAutomaton kKeywordAutomaton = buildKeywordAutomaton();
+static_assert(kKeywordAutomaton.states <= KeywordAutomaton::kMaxStates);
+
+enum class LineKind : uint8_t {
+    Other,
+    Image,
+    Namespace,
+    TypeHeader,
+    Section
+};
+
+struct LineClass {
+    LineKind kind = LineKind::Other;
+    bool comment = false;
+    // First match of each keyword, or npos; type keywords only count as whole words followed by a space or tab.
+    size_t at[KwCount];
+    std::string_view name;      // assembly, namespace or type name
+    std::string_view typeKind;
+    int index = -1;             // image base or TypeDefIndex
+    Section section = Section::None;
+};
+
+static bool parseImageLine(std::string_view s, LineClass& lc) {
     const auto colon = s.find(':');
-    if (colon == std::string::npos)
+    if (colon == std::string_view::npos)
         return false;
     const auto dash = s.rfind('-');
-    if (dash == std::string::npos || dash <= colon)
+    if (dash == std::string_view::npos || dash <= colon)
         return false;
 
-    assemblyOut = trim(s.substr(colon + 1, dash - (colon + 1)));
-    const std::string idxStr = trim(s.substr(dash + 1));
+    lc.name = trim(s.substr(colon + 1, dash - (colon + 1)));
     int v = 0;
-    if (!tryParseInt(idxStr, v))
-        return false;
-    baseTypeDefIndexOut = v;
-    return !assemblyOut.empty();
-}
-
-static bool tryParseNamespaceLine(const std::string& s, std::string& nsOut) {
-    if (!startsWith(s, "//"))
-        return false;
-    const auto p = s.find("Namespace:");
-    if (p == std::string::npos)
+    if (!tryParseInt(trim(s.substr(dash + 1)), v))
         return false;
-    nsOut = trim(s.substr(p + std::char_traits<char>::length("Namespace:")));
-    return true;
+    lc.index = v;
+    return !lc.name.empty();
 }
 
-static bool tryParseSectionLine(const std::string& s, std::string& sectionOut) {
-    if (!startsWith(s, "//"))
+static bool parseTypeLine(std::string_view s, LineClass& lc) {
+    size_t k = KwClass;
+    while (k <= KwInterface && lc.at[k] == std::string_view::npos)
+        ++k;
+    if (k > KwInterface)
         return false;
-    const std::string t = trim(s.substr(2));
-    if (t == "Methods" || t == "Fields" || t == "Properties" || t == "Events") {
-        sectionOut = t;
-        return true;
-    }
-    return false;
-}
-
-static int findTypeKeywordPos(const std::string& s, std::string& kwOut) {
-    static const char* kws[] = {"class", "struct", "enum", "interface"};
-    for (const auto* kw : kws) {
-        size_t pos = 0;
-        while (true) {
-            pos = s.find(kw, pos);
-            if (pos == std::string::npos)
-                break;
-            const bool leftOk = (pos == 0) || !((s[pos - 1] >= 'A' && s[pos - 1] <= 'Z') || (s[pos - 1] >= 'a' && s[pos - 1] <= 'z') || (s[pos - 1] >= '0' && s[pos - 1] <= '9') || s[pos - 1] == '_');
-            const size_t end = pos + std::char_traits<char>::length(kw);
-            const bool rightOk = (end < s.size()) && (s[end] == ' ' || s[end] == '\t');
-            if (leftOk && rightOk) {
-                kwOut = kw;
-                return (int)pos;
-            }
-            pos = end;
-        }
-    }
-    return -1;
-}
 
-static bool tryParseTypeLine(const std::string& s, std::string& kindOut, std::string& nameOut) {
-    std::string kw;
-    const int pos = findTypeKeywordPos(s, kw);
-    if (pos < 0)
-        return false;
-    size_t i = (size_t)pos + kw.size();
+    size_t i = lc.at[k] + kKeywords[k].size();
     while (i < s.size() && (s[i] == ' ' || s[i] == '\t'))
         ++i;
     if (i >= s.size())
@@ -165,104 +241,163 @@ static bool tryParseTypeLine(const std::string& s, std::string& kindOut, std::st
     }
     if (j == i)
         return false;
-    kindOut = kw;
-    nameOut = s.substr(i, j - i);
-    return !nameOut.empty();
+    lc.typeKind = kKeywords[k];
+    lc.name = s.substr(i, j - i);
+
+    lc.index = -1;
+    if (lc.at[KwTypeDefIndex] != std::string_view::npos) {
+        i = lc.at[KwTypeDefIndex] + kKeywords[KwTypeDefIndex].size();
+        while (i < s.size() && (s[i] == ' ' || s[i] == '\t'))
+            ++i;
+        j = i;
+        while (j < s.size() && (s[j] >= '0' && s[j] <= '9'))
+            ++j;
+        if (j == i || !tryParseInt(s.substr(i, j - i), lc.index))
+            lc.index = -1;
+    }
+    return true;
 }
 
-static bool tryParseTypeDefIndex(const std::string& s, int& out) {
-    const auto p = s.find("TypeDefIndex:");
-    if (p == std::string::npos)
-        return false;
-    size_t i = p + std::char_traits<char>::length("TypeDefIndex:");
-    while (i < s.size() && (s[i] == ' ' || s[i] == '\t'))
-        ++i;
-    size_t j = i;
-    while (j < s.size() && (s[j] >= '0' && s[j] <= '9'))
-        ++j;
-    if (j == i)
-        return false;
-    return tryParseInt(s.substr(i, j - i), out);
+static bool parseSectionLine(std::string_view s, Section& sectionOut) {
+    const std::string_view t = trim(s.substr(2));
+    if (t == "Methods") sectionOut = Section::Methods;
+    else if (t == "Fields") sectionOut = Section::Fields;
+    else if (t == "Properties") sectionOut = Section::Properties;
+    else if (t == "Events") sectionOut = Section::Events;
+    else return false;
+    return true;
 }
 
-static std::string parseLeadingModifiers(const std::string& leftPart, std::string& remainderOut) {
-    static const char* mods[] = {
+// Finds every keyword of a trimmed line in one forward pass, then classifies it with the usual precedence:
+// image, namespace, type header, section, anything else.
+static LineClass classifyLine(std::string_view s) {
+    LineClass lc;
+    std::fill(std::begin(lc.at), std::end(lc.at), std::string_view::npos);
+
+    const KeywordAutomaton& dfa = kKeywordAutomaton;
+    size_t state = 0;
+    for (size_t i = 0; i < s.size(); ++i) {
+        state = dfa.next[state][(uint8_t)s[i]];
+        if (state < dfa.firstMatch)
+            continue;
+        for (unsigned m = dfa.matches[state]; m != 0; m &= m - 1) {
+            const unsigned k = (unsigned)std::countr_zero(m);
+            if (lc.at[k] != std::string_view::npos)
+                continue;
+            const size_t end = i + 1;
+            const size_t begin = end - kKeywords[k].size();
+            if (k <= KwInterface) {
+                const bool leftOk = begin == 0 || !isIdentChar(s[begin - 1]);
+                const bool rightOk = end < s.size() && (s[end] == ' ' || s[end] == '\t');
+                if (!leftOk || !rightOk)
+                    continue;
+            }
+            lc.at[k] = begin;
+        }
+    }
+
+    lc.comment = s.starts_with("//");
+    if (lc.comment && lc.at[KwImage] != std::string_view::npos && parseImageLine(s, lc)) {
+        lc.kind = LineKind::Image;
+    } else if (lc.comment && lc.at[KwNamespace] != std::string_view::npos) {
+        lc.name = trim(s.substr(lc.at[KwNamespace] + kKeywords[KwNamespace].size()));
+        lc.kind = LineKind::Namespace;
+    } else if (parseTypeLine(s, lc)) {
+        lc.kind = LineKind::TypeHeader;
+    } else if (lc.comment && parseSectionLine(s, lc.section)) {
+        lc.kind = LineKind::Section;
+    }
+    return lc;
+}
+
+static bool isModifier(std::string_view tok) {
+    static constexpr std::string_view mods[] = {
         "public","private","protected","internal","static","virtual","override","abstract","sealed","extern",
         "readonly","const","volatile","unsafe","new","partial","async","ref","out","in"
     };
+    for (const auto m : mods) {
+        if (tok == m)
+            return true;
+    }
+    return false;
+}
+
+static std::string_view nextToken(std::string_view s, size_t& i) {
+    while (i < s.size() && (s[i] == ' ' || s[i] == '\t'))
+        ++i;
+    size_t j = i;
+    while (j < s.size() && s[j] != ' ' && s[j] != '\t')
+        ++j;
+    const std::string_view tok = s.substr(i, j - i);
+    i = j;
+    return tok;
+}
 
+static std::string_view parseLeadingModifiers(std::string_view leftPart, std::string_view& remainderOut) {
+    const std::string_view s = trim(leftPart);
     size_t i = 0;
-    std::string modsOut;
-    std::string s = leftPart;
-    s = trim(s);
+    size_t modsEnd = 0;
     while (i < s.size()) {
-        while (i < s.size() && (s[i] == ' ' || s[i] == '\t'))
-            ++i;
-        if (i >= s.size())
-            break;
         size_t j = i;
-        while (j < s.size() && s[j] != ' ' && s[j] != '\t')
-            ++j;
-        const std::string tok = s.substr(i, j - i);
-        bool isMod = false;
-        for (const auto* m : mods) {
-            if (tok == m) {
-                isMod = true;
-                break;
-            }
-        }
-        if (!isMod)
+        const std::string_view tok = nextToken(s, j);
+        if (tok.empty() || !isModifier(tok))
             break;
-        if (!modsOut.empty())
-            modsOut += " ";
-        modsOut += tok;
+        modsEnd = j;
         i = j;
     }
 
     remainderOut = trim(s.substr(i));
-    return modsOut;
+    return s.substr(0, modsEnd);
+}
+
+static void appendTokens(std::string& out, std::string_view s) {
+    size_t i = 0;
+    bool first = true;
+    while (true) {
+        const std::string_view tok = nextToken(s, i);
+        if (tok.empty())
+            break;
+        if (!first)
+            out += ' ';
+        out += tok;
+        first = false;
+    }
 }
 
-static bool tryParseMethodLike(const std::string& s, std::string& modifiersOut, std::string& returnTypeOut, std::string& nameOut, std::string& paramsOut) {
+static bool tryParseMethodLike(std::string_view s, std::string_view& modifiersOut, std::string_view& returnTypeOut, std::string_view& nameOut, std::string_view& paramsOut) {
     const auto paren = s.find('(');
-    if (paren == std::string::npos)
+    if (paren == std::string_view::npos)
         return false;
     const auto close = s.find(')', paren + 1);
-    if (close == std::string::npos)
+    if (close == std::string_view::npos)
         return false;
 
     paramsOut = trim(s.substr(paren + 1, close - (paren + 1)));
 
-    std::string left = trim(s.substr(0, paren));
-    std::string rem;
-    modifiersOut = parseLeadingModifiers(left, rem);
+    std::string_view rem;
+    modifiersOut = parseLeadingModifiers(s.substr(0, paren), rem);
 
     if (rem.empty())
         return false;
-    std::vector<std::string> parts;
-    {
-        size_t i = 0;
-        while (i < rem.size()) {
-            while (i < rem.size() && (rem[i] == ' ' || rem[i] == '\t'))
-                ++i;
-            if (i >= rem.size()) break;
-            size_t j = i;
-            while (j < rem.size() && rem[j] != ' ' && rem[j] != '\t')
-                ++j;
-            parts.push_back(rem.substr(i, j - i));
-            i = j;
-        }
-    }
-    if (parts.empty())
-        return false;
-    nameOut = parts.back();
-    returnTypeOut.clear();
-    if (parts.size() >= 2)
-        returnTypeOut = parts[parts.size() - 2];
+
+    size_t j = rem.size();
+    size_t i = j;
+    while (i > 0 && rem[i - 1] != ' ' && rem[i - 1] != '\t')
+        --i;
+    nameOut = rem.substr(i, j - i);
+
+    returnTypeOut = {};
+    while (i > 0 && (rem[i - 1] == ' ' || rem[i - 1] == '\t'))
+        --i;
+    j = i;
+    while (i > 0 && rem[i - 1] != ' ' && rem[i - 1] != '\t')
+        --i;
+    if (j > i)
+        returnTypeOut = rem.substr(i, j - i);
     return true;
 }
 
-static int countParamsTopLevel(const std::string& params) {
+static int countParamsTopLevel(std::string_view params) {
     size_t i = 0;
     while (i < params.size() && (params[i] == ' ' || params[i] == '\t'))
         ++i;
@@ -279,244 +414,1081 @@ static int countParamsTopLevel(const std::string& params) {
     return count;
 }
 
-std::vector<DumpType> DumpCsParser::parse(const std::string& path) {
-    std::ifstream f(path, std::ios::binary);
-    std::vector<DumpType> out;
-    if (!f.is_open())
-        return out;
+// Splits "Name = value;" enum lines; shared by the scanner and deferred signature decoding.
+static bool tryParseEnumValue(std::string_view s, std::string_view& nameOut, std::string_view& valueOut) {
+    const auto eq = s.find('=');
+    if (eq == std::string_view::npos)
+        return false;
+    const auto semi = s.find(';', eq + 1);
+    const std::string_view left = trim(s.substr(0, eq));
+    valueOut = (semi == std::string_view::npos) ? trim(s.substr(eq + 1)) : trim(s.substr(eq + 1, semi - (eq + 1)));
+
+    size_t j = left.size();
+    while (j > 0 && (left[j - 1] == ' ' || left[j - 1] == '\t'))
+        --j;
+    size_t i = j;
+    while (i > 0 && isIdentChar(left[i - 1]))
+        --i;
+    nameOut = left.substr(i, j - i);
+    return !nameOut.empty();
+}
 
-    const std::uintmax_t totalSize =
-        std::filesystem::exists(path) ? std::filesystem::file_size(path) : 0;
+// The identifier a field, property or event line declares, so these members are named like methods: for fields the
+// one before the first ';' or '=', for properties the one before '{', for events the one after the event's type.
+static std::string_view declaredMemberName(MemberKind kind, std::string_view s) {
+    auto isBlank = [](char c) { return c == ' ' || c == '\t'; };
+    auto identAt = [&s](size_t i) {
+        size_t j = i;
+        while (j < s.size() && isIdentChar(s[j]))
+            ++j;
+        return s.substr(i, j - i);
+    };
 
-    std::string line;
-    std::string currentNs;
-    DumpType* currentType = nullptr;
-    std::string section;
+    if (kind == MemberKind::Event) {
+        for (size_t at = s.find("event"); at != std::string_view::npos; at = s.find("event", at + 1)) {
+            size_t i = at + 5;
+            if ((at > 0 && isIdentChar(s[at - 1])) || i >= s.size() || !isBlank(s[i]))
+                continue;
+            while (i < s.size() && isBlank(s[i]))
+                ++i;
+            while (i < s.size() && !isBlank(s[i]))
+                ++i;
+            while (i < s.size() && isBlank(s[i]))
+                ++i;
+            const std::string_view name = identAt(i);
+            return (name.empty() || (name[0] >= '0' && name[0] <= '9')) ? std::string_view{} : name;
+        }
+        return {};
+    }
 
-    struct ImageMapEntry {
-        int baseTypeDefIndex = -1;
-        std::string assembly;
-    };
+    const std::string_view stops = (kind == MemberKind::Property) ? "{" : ";=";
+    for (size_t p = s.find_first_of(stops); p != std::string_view::npos; p = s.find_first_of(stops, p + 1)) {
+        size_t j = p;
+        while (j > 0 && isBlank(s[j - 1]))
+            --j;
+        size_t i = j;
+        while (i > 0 && isIdentChar(s[i - 1]))
+            --i;
+        if (i < j && !(s[i] >= '0' && s[i] <= '9'))
+            return s.substr(i, j - i);
+    }
+    return {};
+}
+
+static void buildMethodSignature(std::string& sig, std::string_view modifiers, std::string_view returnType,
+                                 std::string_view methodName, std::string_view params) {
+    sig.clear();
+    if (!modifiers.empty()) {
+        appendTokens(sig, modifiers);
+        sig += ' ';
+    }
+    if (!returnType.empty()) {
+        sig += returnType;
+        sig += ' ';
+    }
+    sig.append(methodName).append("(").append(params).append(")");
+}
+
+struct ChunkScan {
+    std::vector<std::pair<size_t, ImageMapEntry>> images;
+    size_t types = 0;
+    size_t typesBeforeFirstNamespace = 0;
+    bool sawNamespace = false;
+    std::string lastNamespace;
+};
+
+// Namespace and image table left open by the text before a chunk, for scans that continue an earlier one.
+struct ScanCarry {
+    std::string ns;
+    std::map<int, std::string> images;
+};
+
+static std::string_view resolveAssembly(const std::map<int, std::string_view>& imageByBase, int typeDefIndex) {
+    if (typeDefIndex < 0)
+        return {};
+    auto it = imageByBase.upper_bound(typeDefIndex);
+    if (it == imageByBase.begin())
+        return {};
+    return std::prev(it)->second;
+}
+
+static char lowerAscii(char c) {
+    return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+}
+
+static bool globMatch(std::string_view pattern, std::string_view s) {
+    size_t p = 0, i = 0;
+    size_t starP = std::string_view::npos, starI = 0;
+    while (i < s.size()) {
+        if (p < pattern.size() && pattern[p] == '*') {
+            starP = p++;
+            starI = i;
+        } else if (p < pattern.size() && (pattern[p] == '?' || lowerAscii(pattern[p]) == lowerAscii(s[i]))) {
+            ++p;
+            ++i;
+        } else if (starP != std::string_view::npos) {
+            p = starP + 1;
+            i = ++starI;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '*')
+        ++p;
+    return p == pattern.size();
+}
+
+static bool matchesAny(const std::vector<std::string>& patterns, std::string_view assembly) {
+    std::string_view stem = assembly;
+    if (stem.size() > 4 && globMatch(".dll", stem.substr(stem.size() - 4)))
+        stem.remove_suffix(4);
+    for (const auto& pattern : patterns) {
+        const std::string_view p = trim(pattern);
+        if (!p.empty() && (globMatch(p, assembly) || globMatch(p, stem)))
+            return true;
+    }
+    return false;
+}
+
+bool AssemblyFilter::allows(std::string_view assembly) const {
+    return (include.empty() || matchesAny(include, assembly)) && !matchesAny(exclude, assembly);
+}
+
+// The image table precedes the first namespace or type header; stops there.
+static std::vector<ImageMapEntry> readImageTable(std::string_view text) {
     std::vector<ImageMapEntry> images;
+    for (size_t pos = 0; pos < text.size();) {
+        size_t eol = findNewline(text, pos);
+        if (eol == std::string_view::npos)
+            eol = text.size();
+        const LineClass lc = classifyLine(trim(text.substr(pos, eol - pos)));
+        pos = eol + 1;
+        if (lc.kind == LineKind::Image)
+            images.push_back({lc.index, std::string(lc.name)});
+        else if (lc.kind == LineKind::Namespace || lc.kind == LineKind::TypeHeader)
+            break;
+    }
+    std::stable_sort(images.begin(), images.end(), [](const ImageMapEntry& a, const ImageMapEntry& b) {
+        return a.baseTypeDefIndex < b.baseTypeDefIndex;
+    });
+    return images;
+}
+
+// An AssemblyFilter resolved to TypeDefIndex ranges; types outside every image (or without an index) are kept.
+struct TypeFilter {
+    std::vector<int> bases;
+    std::vector<uint8_t> skipped;
+
+    bool skips(int typeDefIndex) const {
+        const auto it = std::upper_bound(bases.begin(), bases.end(), typeDefIndex);
+        return typeDefIndex >= 0 && it != bases.begin() && skipped[(size_t)(it - bases.begin()) - 1] != 0;
+    }
+};
+
+static TypeFilter resolveTypeFilter(const AssemblyFilter& assemblies, std::string_view text) {
+    TypeFilter filter;
+    if (assemblies.empty())
+        return filter;
+    for (const auto& image : readImageTable(text)) {
+        filter.bases.push_back(image.baseTypeDefIndex);
+        filter.skipped.push_back(assemblies.allows(image.assembly) ? 0 : 1);
+    }
+    return filter;
+}
+
+template <typename Visitor>
+static void scanChunk(std::string_view text, Visitor& visitor, ChunkScan& scan, std::atomic<size_t>& bytesDone, uint64_t sourceBase,
+                      bool headersOnly = false, const TypeFilter* filter = nullptr, const ScanCarry* carry = nullptr) {
+    std::string_view currentNs;
+    std::string_view currentTypeNs = "-";
+    std::string_view currentTypeName;
+    bool haveType = false;
+    bool currentIsEnum = false;
+    Section section = Section::None;
 
     bool hasPending = false;
     uint64_t pendingRva = 0, pendingOff = 0, pendingVa = 0;
+    size_t pendingBegin = 0;
+
+    // Spans are relative to text until offset by sourceBase; types close at their brace or before the next header.
+    bool typeOpen = false;
+    size_t typeBegin = 0;
+    size_t lastContentEnd = 0;
+    auto spanOf = [sourceBase](size_t begin, size_t end) {
+        return SourceSpan{sourceBase + begin, (uint32_t)std::min<size_t>(end - begin, UINT32_MAX)};
+    };
+    auto closeType = [&](size_t end) {
+        if (typeOpen)
+            visitor.onTypeEnd(spanOf(typeBegin, std::max(end, typeBegin)));
+        typeOpen = false;
+    };
 
-    size_t lineCount = 0;
+    std::string sig;
+    DumpMemberInfo member;
+    std::map<int, std::string_view> imageByBase;
+    if (carry) {
+        if (!carry->ns.empty())
+            currentNs = currentTypeNs = carry->ns;
+        for (const auto& [base, assembly] : carry->images)
+            imageByBase[base] = assembly;
+    }
 
-    while (std::getline(f, line)) {
-        if (++lineCount % 200 == 0 && g_progressCb && totalSize > 0) {
-            const auto pos = static_cast<std::uintmax_t>(f.tellg());
-            int percent = static_cast<int>((pos * 100) / totalSize);
-            g_progressCb(std::clamp(percent, 0, 100));
+    size_t lineCount = 0;
+    size_t pos = 0;
+    size_t reported = 0;
+
+    while (pos < text.size()) {
+        size_t eol = findNewline(text, pos);
+        if (eol == std::string_view::npos)
+            eol = text.size();
+        const std::string_view line = text.substr(pos, eol - pos);
+        pos = eol + 1;
+
+        if (++lineCount % 200 == 0) {
+            const size_t consumed = std::min(pos, text.size());
+            bytesDone.fetch_add(consumed - reported, std::memory_order_relaxed);
+            reported = consumed;
         }
 
-        std::string s = trim(line);
+        const std::string_view s = trim(line);
+        const size_t sBegin = (size_t)((s.empty() ? line.data() : s.data()) - text.data());
+        const size_t sEnd = sBegin + s.size();
 
-        {
-            std::string asmName;
-            int baseIdx = -1;
-            if (tryParseImageLine(s, asmName, baseIdx)) {
-                ImageMapEntry e;
-                e.assembly = std::move(asmName);
-                e.baseTypeDefIndex = baseIdx;
-                images.push_back(std::move(e));
-                continue;
-            }
+        const LineClass lc = classifyLine(s);
+
+        if (lc.kind == LineKind::Image) {
+            closeType(lastContentEnd);
+            scan.images.push_back({scan.types, {lc.index, std::string(lc.name)}});
+            imageByBase[lc.index] = lc.name;
+            visitor.onImage({lc.name, lc.index});
+            continue;
         }
 
-        {
-            std::string ns;
-            if (tryParseNamespaceLine(s, ns)) {
-                currentNs = std::move(ns);
-                if (currentNs.empty()) currentNs = "-";
-                continue;
-            }
+        if (lc.kind == LineKind::Namespace) {
+            closeType(lastContentEnd);
+            currentNs = lc.name.empty() ? std::string_view("-") : lc.name;
+            currentTypeNs = currentNs;
+            scan.sawNamespace = true;
+            continue;
         }
 
-        {
-            std::string kind;
-            std::string typeName;
-            if (tryParseTypeLine(s, kind, typeName)) {
-                out.push_back({});
-                currentType = &out.back();
-                currentType->name = std::move(typeName);
-                currentType->nameSpace = currentNs.empty() ? "-" : currentNs;
-                currentType->isEnum = (kind == "enum");
-
-                int typeDefIdx = -1;
-                if (tryParseTypeDefIndex(s, typeDefIdx)) {
-                    currentType->typeDefIndex = typeDefIdx;
-                    std::string asmResolved;
-                    int bestBase = -1;
-                    for (const auto& img : images) {
-                        if (img.baseTypeDefIndex <= currentType->typeDefIndex && img.baseTypeDefIndex >= bestBase) {
-                            bestBase = img.baseTypeDefIndex;
-                            asmResolved = img.assembly;
-                        }
-                    }
-                    currentType->assembly = std::move(asmResolved);
-                }
+        if (lc.kind == LineKind::TypeHeader && filter && filter->skips(lc.index)) {
+            closeType(lastContentEnd);
+            haveType = false;
+            continue;
+        }
 
-                section.clear();
-                hasPending = false;
-                continue;
-            }
+        if (lc.kind == LineKind::TypeHeader) {
+            if (!scan.sawNamespace)
+                ++scan.typesBeforeFirstNamespace;
+
+            closeType(lastContentEnd);
+            haveType = true;
+            currentIsEnum = (lc.typeKind == "enum");
+            currentTypeName = lc.name;
+            ++scan.types;
+            visitor.onType({lc.name, currentTypeNs, resolveAssembly(imageByBase, lc.index), lc.index, currentIsEnum,
+                            spanOf(sBegin, sEnd)});
+            typeOpen = true;
+            typeBegin = sBegin;
+            lastContentEnd = sEnd;
+
+            section = Section::None;
+            hasPending = false;
+            pendingRva = pendingOff = pendingVa = 0;
+            continue;
         }
 
-        if (!currentType)
+        if (!s.empty())
+            lastContentEnd = sEnd;
+        if (typeOpen && line.starts_with('}'))
+            closeType(sEnd);
+
+        if (!haveType || headersOnly)
             continue;
 
-        {
-            std::string sec;
-            if (tryParseSectionLine(s, sec)) {
-                section = std::move(sec);
-                continue;
-            }
+        if (lc.kind == LineKind::Section) {
+            section = lc.section;
+            continue;
         }
 
-        if (section.empty())
+        if (section == Section::None)
             continue;
 
-        if (currentType->isEnum && section == "Fields") {
-            if (s.find("value__") != std::string::npos) {
-                DumpMember mem;
-                mem.kind = MemberKind::Field;
-                mem.signature = stripInlineComment(s);
-
+        if (currentIsEnum && section == Section::Fields) {
+            if (s.find("value__") != std::string_view::npos) {
                 uint64_t off = 0;
-                if (tryExtractFirstInlineHex(s, off))
-                    mem.offset = off;
-
-                currentType->members.push_back(mem);
+                if (!tryExtractFirstInlineHex(s, off))
+                    off = 0;
+                const std::string_view decl = stripInlineComment(s);
+                member = {MemberKind::Field, declaredMemberName(MemberKind::Field, decl), decl, 0, 0, off, 0, spanOf(sBegin, sEnd)};
+                visitor.onMember(member);
                 continue;
             }
 
             {
-                const auto eq = s.find('=');
-                if (eq != std::string::npos) {
-                    const auto semi = s.find(';', eq + 1);
-                    const std::string left = trim(s.substr(0, eq));
-                    std::string right = (semi == std::string::npos) ? trim(s.substr(eq + 1)) : trim(s.substr(eq + 1, semi - (eq + 1)));
-
-                    size_t j = left.size();
-                    while (j > 0 && (left[j - 1] == ' ' || left[j - 1] == '\t'))
-                        --j;
-                    size_t i = j;
-                    while (i > 0) {
-                        const char c = left[i - 1];
-                        const bool ok = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_';
-                        if (!ok) break;
-                        --i;
-                    }
-                    const std::string name = left.substr(i, j - i);
-                    if (!name.empty()) {
-                        DumpMember mem;
-                        mem.kind = MemberKind::EnumValue;
-                        mem.name = name;
-                        mem.signature = mem.name + " = " + right;
-                        currentType->members.push_back(mem);
-                    }
+                std::string_view name;
+                std::string_view value;
+                if (tryParseEnumValue(s, name, value)) {
+                    sig.assign(name).append(" = ").append(value);
+                    member = {MemberKind::EnumValue, name, sig, 0, 0, 0, 0, spanOf(sBegin, sEnd)};
+                    visitor.onMember(member);
                 }
             }
             continue;
         }
 
-        if (section == "Methods") {
-            if (s.rfind("//", 0) == 0 &&
-                (s.find("RVA:") != std::string::npos ||
-                 s.find("Offset:") != std::string::npos ||
-                 s.find("VA:") != std::string::npos)) {
+        if (section == Section::Methods) {
+            if (lc.comment &&
+                (lc.at[KwRva] != std::string_view::npos ||
+                 lc.at[KwOffset] != std::string_view::npos ||
+                 lc.at[KwVa] != std::string_view::npos)) {
 
                 {
                     uint64_t v = 0;
-                    if (tryExtractFirstHexAfter(s, "RVA:", v)) pendingRva = v;
+                    if (tryExtractFirstHexAt(s, lc.at[KwRva], v)) pendingRva = v;
                 }
                 {
                     uint64_t v = 0;
-                    if (tryExtractFirstHexAfter(s, "Offset:", v)) pendingOff = v;
+                    if (tryExtractFirstHexAt(s, lc.at[KwOffset], v)) pendingOff = v;
                 }
                 {
                     uint64_t v = 0;
-                    if (tryExtractFirstHexAfter(s, "VA:", v)) pendingVa = v;
+                    if (tryExtractFirstHexAt(s, lc.at[KwVa], v)) pendingVa = v;
                 }
 
+                if (!hasPending)
+                    pendingBegin = sBegin;
                 hasPending = true;
                 continue;
             }
 
-            if (s.empty() || s == "{" || s == "}" || s.rfind("//", 0) == 0)
+            if (s.empty() || s == "{" || s == "}" || s.starts_with("//"))
                 continue;
 
             if (!hasPending)
                 continue;
 
-            std::string modifiers;
-            std::string returnType;
-            std::string methodName;
-            std::string params;
+            std::string_view modifiers;
+            std::string_view returnType;
+            std::string_view methodName;
+            std::string_view params;
             if (!tryParseMethodLike(s, modifiers, returnType, methodName, params))
                 continue;
 
-            DumpMember mem;
-            mem.name = methodName;
-            mem.paramCount = countParamsTopLevel(params);
-
-            if (mem.name == currentType->name) {
-                mem.kind = MemberKind::Ctor;
-                mem.name = ".ctor";
-                returnType.clear();
+            MemberKind memberKind = MemberKind::Method;
+            if (methodName == currentTypeName) {
+                memberKind = MemberKind::Ctor;
+                methodName = ".ctor";
+                returnType = {};
             } else {
-                if (mem.name.rfind("get_", 0) == 0 || mem.name.rfind("set_", 0) == 0)
-                    mem.kind = MemberKind::Property;
-                else if (mem.name.rfind("add_", 0) == 0 || mem.name.rfind("remove_", 0) == 0)
-                    mem.kind = MemberKind::Event;
-                else
-                    mem.kind = MemberKind::Method;
+                if (methodName.starts_with("get_") || methodName.starts_with("set_"))
+                    memberKind = MemberKind::Property;
+                else if (methodName.starts_with("add_") || methodName.starts_with("remove_"))
+                    memberKind = MemberKind::Event;
             }
 
-            mem.signature.clear();
-            if (!modifiers.empty()) {
-                mem.signature += modifiers;
-                mem.signature += " ";
-            }
-            if (!returnType.empty() && mem.kind != MemberKind::Ctor) {
-                mem.signature += returnType;
-                mem.signature += " ";
-            }
-            mem.signature += mem.name + "(" + params + ")";
+            buildMethodSignature(sig, modifiers, returnType, methodName, params);
 
-            mem.rva = pendingRva;
-            mem.offset = pendingOff ? pendingOff : pendingRva;
-            mem.va = pendingVa;
-            currentType->members.push_back(mem);
+            member = {memberKind, methodName, sig, countParamsTopLevel(params),
+                      pendingRva, pendingOff ? pendingOff : pendingRva, pendingVa, spanOf(pendingBegin, sEnd)};
+            visitor.onMember(member);
 
             hasPending = false;
             pendingRva = pendingOff = pendingVa = 0;
         }
 
-        if (section == "Fields" || section == "Properties" || section == "Events") {
-            if (s.empty() || s == "{" || s == "}" || s.rfind("//", 0) == 0)
+        if (section == Section::Fields || section == Section::Properties || section == Section::Events) {
+            if (s.empty() || s == "{" || s == "}" || s.starts_with("//"))
                 continue;
 
-            DumpMember mem;
-            mem.kind = (section == "Fields") ? MemberKind::Field :
-                       (section == "Properties") ? MemberKind::Property :
-                       MemberKind::Event;
-
-            mem.signature = stripInlineComment(s);
+            const MemberKind memberKind = (section == Section::Fields) ? MemberKind::Field :
+                                          (section == Section::Properties) ? MemberKind::Property :
+                                          MemberKind::Event;
 
             uint64_t off = 0;
-            if (tryExtractFirstInlineHex(s, off))
-                mem.offset = off;
-
-            currentType->members.push_back(mem);
+            if (!tryExtractFirstInlineHex(s, off))
+                off = 0;
+            const std::string_view decl = stripInlineComment(s);
+            member = {memberKind, declaredMemberName(memberKind, decl), decl, 0, 0, off, 0, spanOf(sBegin, sEnd)};
+            visitor.onMember(member);
             continue;
         }
     }
 
-    if (g_progressCb)
-        g_progressCb(100);
+    closeType(lastContentEnd);
+    bytesDone.fetch_add(text.size() - reported, std::memory_order_relaxed);
+    scan.lastNamespace.assign(currentNs);
+}
+
+// Builds one chunk's columns; namespaces of leading types and assemblies are fixed up in mergeChunks.
+class ModelBuilder final : public DumpVisitor {
+public:
+    ModelBuilder(DumpModel& model, bool deferSignatures) : model_(model), deferSignatures_(deferSignatures) {}
+
+    void onType(const DumpTypeInfo& type) override {
+        if (type.nameSpace.data() != lastNs_.data() || type.nameSpace.size() != lastNs_.size()) {
+            lastNs_ = type.nameSpace;
+            lastNsId_ = model_.strings.intern(lastNs_);
+        }
+        model_.addType(model_.strings.intern(type.name), lastNsId_, type.typeDefIndex, type.isEnum, type.span);
+    }
+
+    void onTypeEnd(const SourceSpan& span) override {
+        model_.setTypeSpan(model_.typeCount() - 1, span);
+    }
+
+    void onMember(const DumpMemberInfo& member) override {
+        const SymbolId name = member.name.empty() ? StringPool::kEmpty : model_.strings.intern(member.name);
+        model_.addMember(member.kind, name, deferSignatures_ ? std::string_view{} : member.signature, member.paramCount,
+                         member.rva, member.offset, member.va, member.span);
+    }
+
+private:
+    DumpModel& model_;
+    bool deferSignatures_;
+    std::string_view lastNs_;
+    SymbolId lastNsId_ = StringPool::kEmpty;
+};
+
+struct ChunkResult {
+    DumpModel model;
+    ChunkScan scan;
+    std::atomic<bool> done{false};
+};
+
+// Upper bound on a chunk's signature bytes: declarations are the tab-indented lines other than comments and
+// attributes, and no signature is longer than its line.
+static size_t countSignatureBytes(std::string_view text) {
+    size_t bytes = 0;
+    for (size_t pos = 0; pos < text.size();) {
+        size_t eol = findNewline(text, pos);
+        if (eol == std::string_view::npos)
+            eol = text.size();
+        if (eol - pos > 1 && text[pos] == '\t' && text[pos + 1] != '/' && text[pos + 1] != '[')
+            bytes += eol - pos;
+        pos = eol + 1;
+    }
+    return bytes;
+}
+
+// Counting pre-pass so a chunk's columns are allocated once instead of regrowing: every type body opens with "{" at
+// column 0, every method has an indented "// RVA" comment and fields, properties and enum values end in ';'. All three
+// overcount slightly (section comments, accessor lists), which only costs untouched capacity.
+static void reserveChunk(DumpModel& model, std::string_view text, const ParseOptions& options) {
+    const char* b = text.data();
+    const char* e = text.data() + text.size();
+    const size_t types = ScanKernels::countPair(b, e, '\n', '{') + 1;
+    if (options.skeleton) {
+        model.reserve(types, 0, 0);
+        return;
+    }
+    const size_t members = ScanKernels::countPair(b, e, '\t', '/') + ScanKernels::countByte(b, e, ';');
+    model.reserve(types, members, options.deferSignatures ? 0 : countSignatureBytes(text));
+}
+
+static void parseChunk(std::string_view text, ChunkResult& r, std::atomic<size_t>& bytesDone, uint64_t sourceBase,
+                       const ParseOptions& options, const TypeFilter& filter) {
+    reserveChunk(r.model, text, options);
+    ModelBuilder builder(r.model, options.deferSignatures);
+    scanChunk(text, builder, r.scan, bytesDone, sourceBase, options.skeleton, &filter);
+}
+
+static bool isChunkBoundaryLine(std::string_view s) {
+    const LineClass lc = classifyLine(s);
+    return lc.kind == LineKind::TypeHeader && lc.index >= 0;
+}
+
+static size_t findChunkBoundary(std::string_view text, size_t from) {
+    size_t pos = findNewline(text, from);
+    while (pos != std::string_view::npos && pos + 1 < text.size()) {
+        const size_t begin = pos + 1;
+        size_t eol = findNewline(text, begin);
+        if (eol == std::string_view::npos)
+            eol = text.size();
+        if (isChunkBoundaryLine(trim(text.substr(begin, eol - begin))))
+            return begin;
+        pos = eol;
+    }
+    return text.size();
+}
+
+static std::vector<std::string_view> splitIntoChunks(std::string_view text, unsigned threads) {
+    constexpr size_t kMinChunkBytes = 4u << 20;
+    constexpr size_t kMaxChunkBytes = 64u << 20;
+    std::vector<std::string_view> chunks;
+    const size_t byThreads = std::max<size_t>((size_t)threads * 4, text.size() / kMaxChunkBytes);
+    const size_t wanted = std::max<size_t>(1, std::min<size_t>(byThreads, text.size() / kMinChunkBytes));
+    const size_t step = text.size() / wanted;
+
+    size_t begin = 0;
+    for (size_t i = 1; i < wanted && begin < text.size(); ++i) {
+        const size_t end = findChunkBoundary(text, std::max(begin, i * step));
+        if (end >= text.size())
+            break;
+        if (end > begin) {
+            chunks.push_back(text.substr(begin, end - begin));
+            begin = end;
+        }
+    }
+    chunks.push_back(text.substr(begin));
+    return chunks;
+}
+
+// Carries images and the open namespace across chunk boundaries, in file order.
+struct ChunkLinker {
+    std::map<int, std::string_view> imageByBase;
+    std::string carriedNs;
+};
+
+template <typename Fn>
+static void linkChunk(ChunkLinker& linker, const ChunkScan& scan, Fn&& perType) {
+    const std::string_view carried = linker.carriedNs.empty() ? std::string_view("-") : std::string_view(linker.carriedNs);
+    size_t nextImage = 0;
+    for (size_t i = 0; i < scan.types; ++i) {
+        for (; nextImage < scan.images.size() && scan.images[nextImage].first <= i; ++nextImage)
+            linker.imageByBase[scan.images[nextImage].second.baseTypeDefIndex] = scan.images[nextImage].second.assembly;
+
+        perType(i, i < scan.typesBeforeFirstNamespace ? carried : std::string_view{});
+    }
+    for (; nextImage < scan.images.size(); ++nextImage)
+        linker.imageByBase[scan.images[nextImage].second.baseTypeDefIndex] = scan.images[nextImage].second.assembly;
+
+    if (scan.sawNamespace)
+        linker.carriedNs.assign(scan.lastNamespace);
+}
+
+static void previewChunk(ChunkLinker& linker, const ChunkResult& r, DumpVisitor& observer) {
+    const DumpModel& m = r.model;
+    linkChunk(linker, r.scan, [&](size_t i, std::string_view leadingNs) {
+        const std::string_view ns = leadingNs.empty() ? m.str(m.typeNamespaces[i]) : leadingNs;
+        const std::string_view assembly = resolveAssembly(linker.imageByBase, m.typeDefIndices[i]);
+        observer.onType({m.str(m.typeNames[i]), ns, assembly, m.typeDefIndices[i], m.typeIsEnum[i] != 0, m.type(i).sourceSpan()});
+        for (const MemberView member : m.type(i).members()) {
+            observer.onMember({member.kind(), m.str(member.name()), member.signature(), member.paramCount(), member.rva(),
+                               member.offset(), member.va(), member.sourceSpan()});
+        }
+        observer.onTypeEnd(m.type(i).sourceSpan());
+    });
+}
 
+static DumpModel mergeChunks(std::deque<ChunkResult>& results) {
+    std::vector<DumpModel*> parts;
+    parts.reserve(results.size());
+    for (auto& r : results)
+        parts.push_back(&r.model);
+    std::vector<size_t> typeBases;
+    DumpModel out = DumpModel::concat(parts, typeBases);
+
+    ChunkLinker linker;
+    for (size_t k = 0; k < results.size(); ++k) {
+        const ChunkResult& r = results[k];
+        linkChunk(linker, r.scan, [&](size_t i, std::string_view leadingNs) {
+            if (!leadingNs.empty())
+                out.typeNamespaces[typeBases[k] + i] = out.strings.intern(leadingNs);
+        });
+
+        // Types resolve against the complete table lazily (DumpModel::assemblyFor).
+        for (const auto& entry : r.scan.images)
+            out.addImage(entry.second.baseTypeDefIndex, out.strings.intern(entry.second.assembly));
+    }
     return out;
 }
+
+// Reports only changed values, at most once per interval (the final 100 always goes out).
+class ProgressReporter {
+public:
+    explicit ProgressReporter(const ParseOptions& options) : options_(options) {}
+
+    void report(int percent) {
+        if (!options_.progress || percent == last_)
+            return;
+        const auto now = std::chrono::steady_clock::now();
+        if (percent < 100 && last_ >= 0 && now - lastAt_ < options_.reportInterval)
+            return;
+        last_ = percent;
+        lastAt_ = now;
+        options_.progress(percent);
+    }
+
+private:
+    const ParseOptions& options_;
+    int last_ = -1;
+    std::chrono::steady_clock::time_point lastAt_;
+};
+
+static unsigned workerCount(const ParseOptions& options) {
+    return options.threads > 0 ? (unsigned)options.threads : std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Parses contiguous chunks (the first at source offset sourceBase) into results[first...] on a thread pool;
+// tick runs on the calling thread every reportInterval until done. With a mapped source, a reader thread
+// faults chunks in, in order, at most one round of workers ahead of the chunk being handed out.
+template <typename Tick>
+static void runChunkPool(const std::vector<std::string_view>& chunks, uint64_t sourceBase, std::deque<ChunkResult>& results,
+                         size_t first, unsigned workers, const ParseOptions& options, const TypeFilter& filter,
+                         const MappedFile* source, std::atomic<size_t>& bytesDone, Tick&& tick) {
+    workers = std::min<unsigned>(workers, (unsigned)chunks.size());
+    std::atomic<size_t> nextChunk{0};
+    unsigned running = workers;
+    std::mutex doneMutex;
+    std::condition_variable doneCv;
+
+    size_t loaded = source ? 0 : chunks.size();
+    std::mutex loadMutex;
+    std::condition_variable loadCv;
+    std::thread reader;
+    if (source) {
+        reader = std::thread([&]() {
+            for (size_t i = 0; i < chunks.size() && !options.cancel.isCancelled(); ++i) {
+                {
+                    std::unique_lock<std::mutex> lock(loadMutex);
+                    loadCv.wait(lock, [&]() { return i < nextChunk.load() + workers || options.cancel.isCancelled(); });
+                }
+                source->prefetch((size_t)(chunks[i].data() - source->data()), chunks[i].size());
+                std::lock_guard<std::mutex> lock(loadMutex);
+                loaded = i + 1;
+                loadCv.notify_all();
+            }
+            if (options.timings)
+                options.timings->readEnd = ParseTimings::Clock::now();
+            std::lock_guard<std::mutex> lock(loadMutex);
+            loaded = chunks.size();
+            loadCv.notify_all();
+        });
+    }
+    auto waitLoaded = [&](size_t i) {
+        std::unique_lock<std::mutex> lock(loadMutex);
+        loadCv.notify_all();
+        loadCv.wait(lock, [&]() { return loaded > i; });
+    };
+
+    auto work = [&]() {
+        for (size_t i = nextChunk++; i < chunks.size() && !options.cancel.isCancelled(); i = nextChunk++) {
+            waitLoaded(i);
+            ChunkResult& r = results[first + i];
+            parseChunk(chunks[i], r, bytesDone, sourceBase + (uint64_t)(chunks[i].data() - chunks.front().data()), options, filter);
+            r.done.store(true, std::memory_order_release);
+        }
+        std::lock_guard<std::mutex> lock(doneMutex);
+        if (--running == 0)
+            doneCv.notify_one();
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(workers);
+    for (unsigned i = 0; i < workers; ++i)
+        pool.emplace_back(work);
+
+    const auto interval = std::max(options.reportInterval, std::chrono::milliseconds(1));
+    {
+        std::unique_lock<std::mutex> lock(doneMutex);
+        while (!doneCv.wait_for(lock, interval, [&]() { return running == 0; })) {
+            lock.unlock();
+            tick();
+            lock.lock();
+        }
+    }
+    for (auto& t : pool)
+        t.join();
+    if (reader.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(loadMutex);
+            loadCv.notify_all();
+        }
+        reader.join();
+    }
+}
+
+struct ChunkPreviewer {
+    explicit ChunkPreviewer(DumpVisitor* o) : observer(o) {}
+
+    DumpVisitor* observer;
+    ChunkLinker linker;
+    size_t next = 0;
+
+    void drain(const std::deque<ChunkResult>& results) {
+        if (!observer)
+            return;
+        for (; next < results.size() && results[next].done.load(std::memory_order_acquire); ++next)
+            previewChunk(linker, results[next], *observer);
+    }
+
+    void finish() {
+        if (observer)
+            observer->onEnd();
+    }
+};
+
+static void stamp(const ParseOptions& options, ParseTimings::Clock::time_point ParseTimings::*stage) {
+    if (options.timings)
+        options.timings->*stage = ParseTimings::Clock::now();
+}
+
+static DumpModel parseText(std::string_view text, const ParseOptions& options, const MappedFile* source) {
+    const unsigned workers = workerCount(options);
+    // Split even for a single worker so cancellation has chunk boundaries to act on.
+    const std::vector<std::string_view> chunks = splitIntoChunks(text, workers);
+
+    std::deque<ChunkResult> results;
+    for (size_t i = 0; i < chunks.size(); ++i)
+        results.emplace_back();
+
+    const TypeFilter filter = resolveTypeFilter(options.assemblies, text);
+    std::atomic<size_t> bytesDone{0};
+    ProgressReporter progress(options);
+    ChunkPreviewer preview(options.observer);
+    if (!source)
+        stamp(options, &ParseTimings::readEnd);
+    runChunkPool(chunks, 0, results, 0, workers, options, filter, source, bytesDone, [&]() {
+        if (!text.empty()) {
+            const int percent = static_cast<int>((bytesDone.load(std::memory_order_relaxed) * 100) / text.size());
+            progress.report(std::clamp(percent, 0, 99));
+        }
+        if (!options.cancel.isCancelled())
+            preview.drain(results);
+    });
+    stamp(options, &ParseTimings::parseEnd);
+
+    if (options.cancel.isCancelled())
+        return {};
+
+    preview.drain(results);
+    preview.finish();
+
+    DumpModel out = mergeChunks(results);
+    progress.report(100);
+    return out;
+}
+
+// A decoder thread fills one block while the caller consumes the previous one. Each step hands onText the buffered
+// text up to the last type header seen, at its offset in the decoded stream; the remainder carries over into the next
+// block, so at most two blocks and one carried tail are held at a time. onText returns false to stop early.
+template <typename Fn>
+static void streamCompressed(std::string_view compressed, Compression kind, const ParseOptions& options,
+                             std::atomic<size_t>& consumed, Fn&& onText) {
+    constexpr size_t kBlockBytes = 32u << 20;
+    constexpr size_t kTailSearch = 1u << 20;
+
+    CompressedStream stream;
+    stream.open(compressed, kind);
+
+    std::unique_ptr<char[]> blocks[2] = {std::unique_ptr<char[]>(new char[kBlockBytes]), std::unique_ptr<char[]>(new char[kBlockBytes])};
+    size_t blockSize[2] = {0, 0};
+    bool blockFull[2] = {false, false};
+    int finalBlock = -1;
+    bool stop = false;
+    std::exception_ptr decodeError;
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    std::thread decoder([&]() {
+        try {
+            for (int slot = 0;; slot ^= 1) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cv.wait(lock, [&]() { return !blockFull[slot] || stop; });
+                    if (stop)
+                        return;
+                }
+
+                size_t n = 0;
+                while (n < kBlockBytes && !options.cancel.isCancelled()) {
+                    const size_t got = stream.read(blocks[slot].get() + n, kBlockBytes - n);
+                    consumed.store(stream.consumed(), std::memory_order_relaxed);
+                    if (got == 0)
+                        break;
+                    n += got;
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                blockSize[slot] = n;
+                blockFull[slot] = true;
+                if (n < kBlockBytes) {
+                    finalBlock = slot;
+                    stamp(options, &ParseTimings::readEnd);
+                }
+                cv.notify_all();
+                if (finalBlock >= 0)
+                    return;
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            decodeError = std::current_exception();
+            cv.notify_all();
+        }
+    });
+
+    auto stopDecoder = [&]() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cv.notify_all();
+        if (decoder.joinable())
+            decoder.join();
+    };
+    struct StopOnExit {
+        decltype(stopDecoder)& fn;
+        ~StopOnExit() { fn(); }
+    } stopOnExit{stopDecoder};
+
+    std::string pending;
+    uint64_t pendingBase = 0;
+    for (int slot = 0;; slot ^= 1) {
+        bool last = false;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&]() { return blockFull[slot] || decodeError; });
+            if (decodeError)
+                break;
+            pending.append(blocks[slot].get(), blockSize[slot]);
+            blockFull[slot] = false;
+            last = finalBlock == slot;
+        }
+        cv.notify_all();
+        if (options.cancel.isCancelled())
+            break;
+
+        size_t cut = pending.size();
+        if (!last) {
+            const size_t nl = pending.rfind('\n');
+            const std::string_view complete(pending.data(), nl == std::string::npos ? 0 : nl + 1);
+            cut = findChunkBoundary(complete, complete.size() > kTailSearch ? complete.size() - kTailSearch : 0);
+            if (cut >= complete.size())
+                cut = findChunkBoundary(complete, 0);
+            if (cut >= complete.size())
+                continue;
+        }
+
+        if (!onText(std::string_view(pending.data(), cut), pendingBase))
+            break;
+        pending.erase(0, cut);
+        pendingBase += cut;
+        if (last)
+            break;
+    }
+
+    stopDecoder();
+    if (decodeError)
+        std::rethrow_exception(decodeError);
+}
+
+static DumpModel parseCompressed(std::string_view compressed, Compression kind, const ParseOptions& options) {
+    const unsigned workers = workerCount(options);
+    std::deque<ChunkResult> results;
+    std::atomic<size_t> bytesDone{0};
+    std::atomic<size_t> consumed{0};
+    ProgressReporter progress(options);
+    ChunkPreviewer preview(options.observer);
+    TypeFilter filter;
+
+    auto tick = [&]() {
+        if (!compressed.empty()) {
+            const int percent = static_cast<int>((consumed.load(std::memory_order_relaxed) * 100) / compressed.size());
+            progress.report(std::clamp(percent, 0, 99));
+        }
+    };
+
+    streamCompressed(compressed, kind, options, consumed, [&](std::string_view text, uint64_t base) {
+        if (base == 0)
+            filter = resolveTypeFilter(options.assemblies, text);
+        const std::vector<std::string_view> chunks = splitIntoChunks(text, workers);
+        const size_t first = results.size();
+        for (size_t i = 0; i < chunks.size(); ++i)
+            results.emplace_back();
+        runChunkPool(chunks, base, results, first, workers, options, filter, nullptr, bytesDone, tick);
+        if (options.cancel.isCancelled())
+            return false;
+
+        preview.drain(results);
+        tick();
+        return true;
+    });
+
+    stamp(options, &ParseTimings::parseEnd);
+    if (options.cancel.isCancelled())
+        return {};
+
+    preview.finish();
+    DumpModel out = mergeChunks(results);
+    progress.report(100);
+    return out;
+}
+
+static bool readSource(const std::string& path, MappedFile& mapped, std::string& buffer, std::string_view& text) {
+    if (mapped.open(path)) {
+        text = mapped.view();
+        return true;
+    }
+
+    std::ifstream f(path, std::ios::binary);
+    if (!f.is_open())
+        return false;
+    f.seekg(0, std::ios::end);
+    const std::streamoff size = f.tellg();
+    f.seekg(0, std::ios::beg);
+    if (size > 0) {
+        buffer.resize((size_t)size);
+        f.read(buffer.data(), size);
+        buffer.resize((size_t)f.gcount());
+    }
+    text = buffer;
+    return true;
+}
+
+static DumpModel parseSource(const std::string& path, const ParseOptions& options) {
+    MappedFile mapped;
+    std::string buffer;
+    std::string_view text;
+    if (!readSource(path, mapped, buffer, text))
+        return {};
+    const Compression kind = CompressedStream::detect(text);
+
+    // Deferred signatures and skeleton bodies are read back from the source, so they need an uncompressed, mappable file.
+    if ((options.deferSignatures || options.skeleton) && (kind != Compression::None || !mapped.isOpen())) {
+        ParseOptions eager = options;
+        eager.deferSignatures = false;
+        eager.skeleton = false;
+        return kind != Compression::None ? parseCompressed(text, kind, eager) : parseText(text, eager, nullptr);
+    }
+    if (kind != Compression::None)
+        return parseCompressed(text, kind, options);
+
+    DumpModel model = parseText(text, options, mapped.isOpen() ? &mapped : nullptr);
+    if (options.deferSignatures && !model.empty() && !SignatureCache::attach(model, path)) {
+        // Without a source to decode from, deferred signatures would all read back empty.
+        ParseOptions eager = options;
+        eager.deferSignatures = false;
+        model = parseText(text, eager, &mapped);
+    }
+    if (options.skeleton)
+        model.markMembersPending();
+    return model;
+}
+
+DumpModel DumpCsParser::parse(const std::string& path, const ParseOptions& options) {
+    stamp(options, &ParseTimings::start);
+    DumpModel model = parseSource(path, options);
+    stamp(options, &ParseTimings::end);
+    return model;
+}
+
+DumpModel DumpCsParser::parseTypeBody(std::string_view source, SourceSpan body, bool deferSignatures) {
+    DumpModel out;
+    if (body.offset > source.size() || body.length > source.size() - body.offset)
+        return out;
+    // With an assembly filter the span runs on through any filtered-out types up to the next kept header, so the text
+    // is cut at the first header after the type's own; headers start at column 0, members are indented.
+    std::string_view text = source.substr((size_t)body.offset, body.length);
+    for (size_t pos = findNewline(text, 0); pos != std::string_view::npos && pos + 1 < text.size();) {
+        const size_t begin = pos + 1;
+        pos = findNewline(text, begin);
+        if (text[begin] == '\t')
+            continue;
+        const size_t end = pos == std::string_view::npos ? text.size() : pos;
+        if (classifyLine(trim(text.substr(begin, end - begin))).kind == LineKind::TypeHeader) {
+            text = text.substr(0, begin);
+            break;
+        }
+    }
+
+    ChunkScan scan;
+    std::atomic<size_t> bytesDone{0};
+    ModelBuilder builder(out, deferSignatures);
+    scanChunk(text, builder, scan, bytesDone, body.offset);
+    return out;
+}
+
+void DumpCsParser::decodeSignature(MemberKind kind, std::string_view source, std::string& out) {
+    out.clear();
+    const size_t firstEol = findNewline(source, 0);
+    const std::string_view first = trim(source.substr(0, firstEol == std::string_view::npos ? source.size() : firstEol));
+
+    if (kind == MemberKind::EnumValue) {
+        std::string_view name;
+        std::string_view value;
+        if (tryParseEnumValue(first, name, value))
+            out.assign(name).append(" = ").append(value);
+        return;
+    }
+
+    // Field-like lines are stored as written; methods span their address comment, attributes and declaration.
+    if (!first.starts_with("//")) {
+        out.assign(stripInlineComment(first));
+        return;
+    }
+
+    const size_t lastNl = source.rfind('\n');
+    const std::string_view decl = trim(lastNl == std::string_view::npos ? source : source.substr(lastNl + 1));
+    std::string_view modifiers;
+    std::string_view returnType;
+    std::string_view methodName;
+    std::string_view params;
+    if (!tryParseMethodLike(decl, modifiers, returnType, methodName, params))
+        return;
+    if (kind == MemberKind::Ctor) {
+        methodName = ".ctor";
+        returnType = {};
+    }
+    buildMethodSignature(out, modifiers, returnType, methodName, params);
+}
+
+std::vector<ImageMapEntry> DumpCsParser::readImages(const std::string& path) {
+    constexpr size_t kHeadBytes = 4u << 20;
+
+    MappedFile mapped;
+    std::string buffer;
+    std::string_view text;
+    if (!readSource(path, mapped, buffer, text))
+        return {};
+
+    std::string decoded;
+    const Compression kind = CompressedStream::detect(text);
+    if (kind != Compression::None) {
+        CompressedStream stream;
+        stream.open(text, kind);
+        decoded.resize(kHeadBytes);
+        size_t n = 0;
+        while (n < kHeadBytes) {
+            const size_t got = stream.read(decoded.data() + n, kHeadBytes - n);
+            if (got == 0)
+                break;
+            n += got;
+        }
+        decoded.resize(n);
+        text = decoded;
+    }
+    return readImageTable(text);
+}
+
+bool DumpCsParser::visit(const std::string& path, DumpVisitor& visitor) {
+    MappedFile mapped;
+    std::string buffer;
+    std::string_view text;
+    if (!readSource(path, mapped, buffer, text))
+        return false;
+
+    ChunkScan scan;
+    std::atomic<size_t> bytesDone{0};
+    const Compression kind = CompressedStream::detect(text);
+    if (kind == Compression::None) {
+        scanChunk(text, visitor, scan, bytesDone, 0);
+    } else {
+        // Each step's text is freed once scanned, so the namespace and images it leaves open are carried as copies.
+        const ParseOptions options;
+        std::atomic<size_t> consumed{0};
+        ScanCarry carry;
+        streamCompressed(text, kind, options, consumed, [&](std::string_view step, uint64_t base) {
+            scan = {};
+            scanChunk(step, visitor, scan, bytesDone, base, false, nullptr, &carry);
+            for (const auto& entry : scan.images)
+                carry.images[entry.second.baseTypeDefIndex] = entry.second.assembly;
+            if (scan.sawNamespace)
+                carry.ns = scan.lastNamespace;
+            return true;
+        });
+    }
+    visitor.onEnd();
+    return true;
+}
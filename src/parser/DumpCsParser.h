@@ -1,42 +1,121 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <functional>
+#include <memory>
 
-enum class MemberKind {
-    Method,
-    Ctor,
-    Field,
-    Property,
-    Event,
-    EnumValue
+#include "DumpModel.h"
+
+struct DumpImageInfo {
+    std::string_view assembly;
+    int baseTypeDefIndex = -1;
 };
 
-struct DumpMember {
-    MemberKind kind;
+struct ImageMapEntry {
+    int baseTypeDefIndex = -1;
+    std::string assembly;
+};
 
-    std::string name;
-    std::string signature;
-    int paramCount = 0;
+struct DumpTypeInfo {
+    std::string_view name;
+    std::string_view nameSpace;
+    std::string_view assembly;
+    int typeDefIndex = -1;
+    bool isEnum = false;
+    // Covers the header line; the full extent arrives with onTypeEnd.
+    SourceSpan span;
+};
 
+struct DumpMemberInfo {
+    MemberKind kind = MemberKind::Method;
+    std::string_view name;
+    std::string_view signature;
+    int paramCount = 0;
     uint64_t rva = 0;
     uint64_t offset = 0;
     uint64_t va = 0;
+    // From the first preceding RVA/Offset comment (methods) through the declaration line.
+    SourceSpan span;
 };
 
-struct DumpType {
-    std::string name;
-    std::string nameSpace;
-    int typeDefIndex = -1;
-    std::string assembly;
-    bool isEnum = false;
+// Push-style callbacks in file order. The views are only valid for the duration of the call.
+class DumpVisitor {
+public:
+    virtual ~DumpVisitor() = default;
+    virtual void onImage(const DumpImageInfo& /*image*/) {}
+    virtual void onType(const DumpTypeInfo& /*type*/) {}
+    virtual void onMember(const DumpMemberInfo& /*member*/) {}
+    // The current type's text, from its header through the closing brace (or the next header).
+    virtual void onTypeEnd(const SourceSpan& /*span*/) {}
+    virtual void onEnd() {}
+};
 
-    std::vector<DumpMember> members;
+// Shared cancellation flag; copies observe the same state.
+class CancellationToken {
+public:
+    void cancel() const { flag_->store(true, std::memory_order_relaxed); }
+    bool isCancelled() const { return flag_->load(std::memory_order_relaxed); }
+
+private:
+    std::shared_ptr<std::atomic<bool>> flag_ = std::make_shared<std::atomic<bool>>(false);
+};
+
+// Assembly name patterns ('*' and '?' wildcards, case-insensitive; "Foo" also matches "Foo.dll"). An assembly is
+// loaded when it matches an include pattern (or there are none) and no exclude pattern.
+struct AssemblyFilter {
+    std::vector<std::string> include;
+    std::vector<std::string> exclude;
+
+    bool empty() const { return include.empty() && exclude.empty(); }
+    bool allows(std::string_view assembly) const;
+};
+
+// Stage boundaries of one parse() call; the reader stage faults in or decompresses the source ahead of the parse workers.
+struct ParseTimings {
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point start;
+    Clock::time_point readEnd;
+    Clock::time_point parseEnd;
+    Clock::time_point end;
+};
+
+struct ParseOptions {
+    int threads = 0;
+    // Called on the parsing thread with 0..100, only when the value changes and at most once per reportInterval.
+    std::function<void(int)> progress;
+    std::chrono::milliseconds reportInterval{50};
+    // Checked at chunk boundaries; a cancelled parse returns an empty model.
+    CancellationToken cancel;
+    // Gets onType and onMember for every type and member in file order while chunks finish, then onEnd, before
+    // parse() returns; calls come from one thread that runs alongside the parse workers.
+    DumpVisitor* observer = nullptr;
+    // Leaves signatures out of the model and decodes them from the mapped source when read (uncompressed files only).
+    bool deferSignatures = false;
+    // Records images, namespaces and type headers with their spans only; members come later from parseTypeBody().
+    bool skeleton = false;
+    // Types of rejected assemblies are skipped at header-scan speed: no members, names or namespaces are built for them.
+    // Resolved against the image table at the head of the dump.
+    AssemblyFilter assemblies;
+    // Filled in when set.
+    ParseTimings* timings = nullptr;
 };
 
 class DumpCsParser {
 public:
-    static void setProgressCallback(const std::function<void(int)>& cb);
-    static std::vector<DumpType> parse(const std::string& path);
-};
\ No newline at end of file
+    static DumpModel parse(const std::string& path, const ParseOptions& options = {});
+    static bool visit(const std::string& path, DumpVisitor& visitor);
+
+    // Reads only the image table at the head of a dump (compressed or not), sorted by base TypeDefIndex.
+    static std::vector<ImageMapEntry> readImages(const std::string& path);
+
+    // Parses one type's members from its DumpModel::typeBodySpan in the (uncompressed) source; the result holds that single type.
+    static DumpModel parseTypeBody(std::string_view source, SourceSpan body, bool deferSignatures = false);
+
+    // Rebuilds a member's signature from its source span, exactly as parse() would have stored it.
+    static void decodeSignature(MemberKind kind, std::string_view source, std::string& out);
+};
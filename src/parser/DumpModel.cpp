@@ -0,0 +1,232 @@
+#include "DumpModel.h"
+
+#include "SignatureCache.h"
+
+#include <algorithm>
+#include <limits>
+
+SymbolId DumpModel::assemblyFor(int typeDefIndex) const {
+    if (typeDefIndex < 0)
+        return StringPool::kEmpty;
+    const auto it = std::upper_bound(imageBases.begin(), imageBases.end(), typeDefIndex);
+    if (it == imageBases.begin())
+        return StringPool::kEmpty;
+    return imageAssemblies[(size_t)(it - imageBases.begin()) - 1];
+}
+
+std::string DumpModel::deferredSignature(size_t memberIndex) const {
+    if (!signatureSource)
+        return {};
+    return signatureSource->lookup(memberKinds[memberIndex], {memberSourceOffsets[memberIndex], memberSourceLengths[memberIndex]});
+}
+
+void DumpModel::addImage(int baseTypeDefIndex, SymbolId assembly) {
+    const auto it = std::lower_bound(imageBases.begin(), imageBases.end(), baseTypeDefIndex);
+    const size_t i = (size_t)(it - imageBases.begin());
+    if (it != imageBases.end() && *it == baseTypeDefIndex) {
+        imageAssemblies[i] = assembly;
+        return;
+    }
+    imageBases.insert(it, baseTypeDefIndex);
+    imageAssemblies.insert(imageAssemblies.begin() + (std::ptrdiff_t)i, assembly);
+}
+
+size_t DumpModel::addType(SymbolId name, SymbolId nameSpace, int typeDefIndex, bool isEnum, SourceSpan span) {
+    const size_t index = typeNames.size();
+    typeNames.push_back(name);
+    typeNamespaces.push_back(nameSpace);
+    typeDefIndices.push_back(typeDefIndex);
+    typeIsEnum.push_back(isEnum ? 1 : 0);
+    typeMemberBegin.push_back((uint32_t)memberKinds.size());
+    typeMemberEnd.push_back((uint32_t)memberKinds.size());
+    typeSourceOffsets.push_back(span.offset);
+    typeSourceLengths.push_back(span.length);
+    return index;
+}
+
+void DumpModel::setTypeSpan(size_t typeIndex, SourceSpan span) {
+    typeSourceOffsets[typeIndex] = span.offset;
+    typeSourceLengths[typeIndex] = span.length;
+}
+
+size_t DumpModel::addMember(MemberKind kind, SymbolId name, size_t sigBegin, int paramCount, uint64_t rva, uint64_t offset, uint64_t va,
+                            SourceSpan span) {
+    const size_t index = pushMember(kind, name, sigBegin, paramCount, rva, offset, va, span);
+    typeMemberEnd.back() = (uint32_t)memberKinds.size();
+    return index;
+}
+
+size_t DumpModel::pushMember(MemberKind kind, SymbolId name, size_t sigBegin, int paramCount, uint64_t rva, uint64_t offset, uint64_t va,
+                             SourceSpan span) {
+    const size_t index = memberKinds.size();
+    memberKinds.push_back(kind);
+    memberNames.push_back(name);
+    memberParamCounts.push_back((uint16_t)std::clamp(paramCount, 0, (int)std::numeric_limits<uint16_t>::max()));
+    memberSigOffsets.push_back(sigBegin);
+    memberSigLengths.push_back((uint32_t)(signatures.size() - sigBegin));
+    memberRvas.push_back(rva);
+    memberOffsets.push_back(offset);
+    memberVas.push_back(va);
+    memberSourceOffsets.push_back(span.offset);
+    memberSourceLengths.push_back(span.length);
+    return index;
+}
+
+size_t DumpModel::addMember(MemberKind kind, SymbolId name, std::string_view signature, int paramCount, uint64_t rva, uint64_t offset, uint64_t va,
+                            SourceSpan span) {
+    const size_t sigBegin = signatures.size();
+    signatures.append(signature);
+    return addMember(kind, name, sigBegin, paramCount, rva, offset, va, span);
+}
+
+template <typename T>
+static void releaseColumn(std::vector<T>& v) {
+    std::vector<T>().swap(v);
+}
+
+// Concatenates one column of every part, mapping values through map(part, value); each part's column is freed as
+// soon as it has been copied.
+template <typename T, typename Map>
+static void concatColumn(std::vector<T>& dst, const std::vector<DumpModel*>& parts, std::vector<T> DumpModel::*column, Map&& map) {
+    size_t total = 0;
+    for (const DumpModel* part : parts)
+        total += (part->*column).size();
+    dst.reserve(total);
+    for (size_t k = 0; k < parts.size(); ++k) {
+        std::vector<T>& src = parts[k]->*column;
+        for (const T& v : src)
+            dst.push_back(map(k, v));
+        releaseColumn(src);
+    }
+}
+
+template <typename T>
+static void concatColumn(std::vector<T>& dst, const std::vector<DumpModel*>& parts, std::vector<T> DumpModel::*column) {
+    concatColumn(dst, parts, column, [](size_t, const T& v) { return v; });
+}
+
+DumpModel DumpModel::concat(const std::vector<DumpModel*>& parts, std::vector<size_t>& typeBases) {
+    DumpModel out;
+    typeBases.assign(parts.size(), 0);
+    std::vector<uint32_t> memberBases(parts.size(), 0);
+    std::vector<uint64_t> sigBases(parts.size(), 0);
+    size_t types = 0, members = 0, sigBytes = 0;
+    for (size_t k = 0; k < parts.size(); ++k) {
+        typeBases[k] = types;
+        memberBases[k] = (uint32_t)members;
+        sigBases[k] = sigBytes;
+        types += parts[k]->typeCount();
+        members += parts[k]->memberCount();
+        sigBytes += parts[k]->signatures.size();
+    }
+
+    std::vector<std::vector<SymbolId>> remaps(parts.size());
+    for (size_t k = 0; k < parts.size(); ++k) {
+        DumpModel& part = *parts[k];
+        std::vector<SymbolId>& remap = remaps[k];
+        remap.resize(part.strings.size());
+        for (SymbolId id = 0; id < (SymbolId)remap.size(); ++id)
+            remap[id] = out.strings.intern(part.strings.view(id));
+        for (size_t i = 0; i < part.imageCount(); ++i)
+            out.addImage(part.imageBases[i], remap[part.imageAssemblies[i]]);
+        part.strings = StringPool{};
+        releaseColumn(part.imageBases);
+        releaseColumn(part.imageAssemblies);
+    }
+    auto symbol = [&remaps](size_t k, SymbolId id) { return remaps[k][id]; };
+
+    concatColumn(out.typeNames, parts, &DumpModel::typeNames, symbol);
+    concatColumn(out.typeNamespaces, parts, &DumpModel::typeNamespaces, symbol);
+    concatColumn(out.typeMemberBegin, parts, &DumpModel::typeMemberBegin, [&](size_t k, uint32_t m) { return m + memberBases[k]; });
+    concatColumn(out.typeMemberEnd, parts, &DumpModel::typeMemberEnd, [&](size_t k, uint32_t m) { return m + memberBases[k]; });
+    concatColumn(out.typeDefIndices, parts, &DumpModel::typeDefIndices);
+    concatColumn(out.typeIsEnum, parts, &DumpModel::typeIsEnum);
+    concatColumn(out.typeSourceOffsets, parts, &DumpModel::typeSourceOffsets);
+    concatColumn(out.typeSourceLengths, parts, &DumpModel::typeSourceLengths);
+
+    concatColumn(out.memberNames, parts, &DumpModel::memberNames, symbol);
+    concatColumn(out.memberSigOffsets, parts, &DumpModel::memberSigOffsets, [&](size_t k, uint64_t o) { return o + sigBases[k]; });
+    concatColumn(out.memberKinds, parts, &DumpModel::memberKinds);
+    concatColumn(out.memberParamCounts, parts, &DumpModel::memberParamCounts);
+    concatColumn(out.memberSigLengths, parts, &DumpModel::memberSigLengths);
+    concatColumn(out.memberRvas, parts, &DumpModel::memberRvas);
+    concatColumn(out.memberOffsets, parts, &DumpModel::memberOffsets);
+    concatColumn(out.memberVas, parts, &DumpModel::memberVas);
+    concatColumn(out.memberSourceOffsets, parts, &DumpModel::memberSourceOffsets);
+    concatColumn(out.memberSourceLengths, parts, &DumpModel::memberSourceLengths);
+
+    out.signatures.reserve(sigBytes);
+    for (DumpModel* part : parts) {
+        out.signatures.append(part->signatures);
+        std::string().swap(part->signatures);
+    }
+
+    for (DumpModel* part : parts)
+        part->clear();
+    return out;
+}
+
+SourceSpan DumpModel::typeBodySpan(size_t typeIndex, uint64_t sourceSize) const {
+    const uint64_t begin = typeSourceOffsets[typeIndex];
+    const uint64_t end = typeIndex + 1 < typeCount() ? typeSourceOffsets[typeIndex + 1] : sourceSize;
+    return {begin, (uint32_t)std::min<uint64_t>(end > begin ? end - begin : 0, std::numeric_limits<uint32_t>::max())};
+}
+
+void DumpModel::markMembersPending() {
+    typeMembersPending.assign(typeCount(), 1);
+    pendingTypes_ = typeCount();
+    if (pendingTypes_ == 0)
+        typeMembersPending.clear();
+}
+
+void DumpModel::adoptMembers(size_t typeIndex, const DumpModel& body) {
+    if (!membersPending(typeIndex))
+        return;
+
+    const uint32_t begin = (uint32_t)memberCount();
+    if (!body.empty()) {
+        const size_t from = body.typeMemberBegin[0];
+        const size_t to = body.typeMemberEnd[0];
+        for (size_t i = from; i < to; ++i) {
+            const SymbolId name = body.memberNames[i] == StringPool::kEmpty ? StringPool::kEmpty : strings.intern(body.str(body.memberNames[i]));
+            const size_t sigBegin = signatures.size();
+            signatures.append(body.signature(i));
+            pushMember(body.memberKinds[i], name, sigBegin, body.memberParamCounts[i], body.memberRvas[i], body.memberOffsets[i],
+                       body.memberVas[i], {body.memberSourceOffsets[i], body.memberSourceLengths[i]});
+        }
+    }
+    typeMemberBegin[typeIndex] = begin;
+    typeMemberEnd[typeIndex] = (uint32_t)memberCount();
+
+    typeMembersPending[typeIndex] = 0;
+    if (--pendingTypes_ == 0)
+        typeMembersPending.clear();
+}
+
+void DumpModel::reserve(size_t types, size_t members, size_t signatureBytes) {
+    typeNames.reserve(types);
+    typeNamespaces.reserve(types);
+    typeDefIndices.reserve(types);
+    typeIsEnum.reserve(types);
+    typeMemberBegin.reserve(types);
+    typeMemberEnd.reserve(types);
+    typeSourceOffsets.reserve(types);
+    typeSourceLengths.reserve(types);
+
+    memberKinds.reserve(members);
+    memberNames.reserve(members);
+    memberParamCounts.reserve(members);
+    memberSigOffsets.reserve(members);
+    memberSigLengths.reserve(members);
+    memberRvas.reserve(members);
+    memberOffsets.reserve(members);
+    memberVas.reserve(members);
+    memberSourceOffsets.reserve(members);
+    memberSourceLengths.reserve(members);
+
+    signatures.reserve(signatureBytes);
+}
+
+void DumpModel::clear() {
+    *this = DumpModel{};
+}
@@ -0,0 +1,195 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include "StringPool.h"
+
+enum class MemberKind : uint8_t {
+    Method,
+    Ctor,
+    Field,
+    Property,
+    Event,
+    EnumValue
+};
+
+// Byte range of an entry in the (decompressed) source text.
+struct SourceSpan {
+    uint64_t offset = 0;
+    uint32_t length = 0;
+};
+
+class DumpModel;
+class SignatureCache;
+
+class MemberView {
+public:
+    MemberView(const DumpModel* model, size_t index) : model_(model), index_(index) {}
+
+    size_t index() const { return index_; }
+    MemberKind kind() const;
+    SymbolId name() const;
+    std::string signature() const;
+    int paramCount() const;
+    uint64_t rva() const;
+    uint64_t offset() const;
+    uint64_t va() const;
+    SourceSpan sourceSpan() const;
+
+private:
+    const DumpModel* model_;
+    size_t index_;
+};
+
+class MemberRange {
+public:
+    class iterator {
+    public:
+        iterator(const DumpModel* model, size_t index) : model_(model), index_(index) {}
+        MemberView operator*() const { return {model_, index_}; }
+        iterator& operator++() { ++index_; return *this; }
+        bool operator!=(const iterator& other) const { return index_ != other.index_; }
+
+    private:
+        const DumpModel* model_;
+        size_t index_;
+    };
+
+    MemberRange(const DumpModel* model, size_t begin, size_t end) : model_(model), begin_(begin), end_(end) {}
+    iterator begin() const { return {model_, begin_}; }
+    iterator end() const { return {model_, end_}; }
+
+private:
+    const DumpModel* model_;
+    size_t begin_;
+    size_t end_;
+};
+
+class TypeView {
+public:
+    TypeView(const DumpModel* model, size_t index) : model_(model), index_(index) {}
+
+    size_t index() const { return index_; }
+    SymbolId name() const;
+    SymbolId nameSpace() const;
+    SymbolId assembly() const;
+    int typeDefIndex() const;
+    bool isEnum() const;
+    SourceSpan sourceSpan() const;
+
+    size_t memberBegin() const;
+    size_t memberCount() const;
+    MemberView member(size_t i) const { return {model_, memberBegin() + i}; }
+    MemberRange members() const { return {model_, memberBegin(), memberBegin() + memberCount()}; }
+
+private:
+    const DumpModel* model_;
+    size_t index_;
+};
+
+class DumpModel {
+public:
+    StringPool strings;
+
+    // Image table as a sorted range index: image i owns TypeDefIndex [imageBases[i], imageBases[i + 1]).
+    std::vector<int32_t> imageBases;
+    std::vector<SymbolId> imageAssemblies;
+
+    std::vector<SymbolId> typeNames;
+    std::vector<SymbolId> typeNamespaces;
+    std::vector<int32_t> typeDefIndices;
+    std::vector<uint8_t> typeIsEnum;
+    std::vector<uint32_t> typeMemberBegin;
+    std::vector<uint32_t> typeMemberEnd;
+    std::vector<uint64_t> typeSourceOffsets;
+    std::vector<uint32_t> typeSourceLengths;
+
+    std::vector<MemberKind> memberKinds;
+    std::vector<SymbolId> memberNames;
+    std::vector<uint16_t> memberParamCounts;
+    std::vector<uint64_t> memberSigOffsets;
+    std::vector<uint32_t> memberSigLengths;
+    std::vector<uint64_t> memberRvas;
+    std::vector<uint64_t> memberOffsets;
+    std::vector<uint64_t> memberVas;
+    std::vector<uint64_t> memberSourceOffsets;
+    std::vector<uint32_t> memberSourceLengths;
+
+    std::string signatures;
+
+    // Skeleton models: nonzero while a type's members have not been parsed yet; empty once every type is complete.
+    std::vector<uint8_t> typeMembersPending;
+
+    // Deferred models leave the signature arena empty and decode from the source spans on demand.
+    bool signaturesDeferred = false;
+    std::shared_ptr<const SignatureCache> signatureSource;
+
+    size_t imageCount() const { return imageBases.size(); }
+    size_t typeCount() const { return typeNames.size(); }
+    size_t memberCount() const { return memberKinds.size(); }
+    bool empty() const { return typeNames.empty(); }
+    bool isSkeleton() const { return !typeMembersPending.empty(); }
+    bool membersPending(size_t typeIndex) const { return isSkeleton() && typeMembersPending[typeIndex] != 0; }
+    size_t pendingTypeCount() const { return pendingTypes_; }
+    // From a type's header up to the next kept type's header (or the end of the source); parseTypeBody() stops at the
+    // first header inside it, which is the text a full parse attributes to the type.
+    SourceSpan typeBodySpan(size_t typeIndex, uint64_t sourceSize) const;
+
+    TypeView type(size_t i) const { return {this, i}; }
+    MemberView member(size_t i) const { return {this, i}; }
+    std::string_view str(SymbolId id) const { return strings.view(id); }
+    // Returned by value: deferred models decode it from the source on demand.
+    std::string signature(size_t memberIndex) const {
+        if (signaturesDeferred)
+            return deferredSignature(memberIndex);
+        return std::string(signatures.data() + memberSigOffsets[memberIndex], memberSigLengths[memberIndex]);
+    }
+
+    SymbolId assemblyFor(int typeDefIndex) const;
+
+    void addImage(int baseTypeDefIndex, SymbolId assembly);
+    size_t addType(SymbolId name, SymbolId nameSpace, int typeDefIndex, bool isEnum, SourceSpan span = {});
+    void setTypeSpan(size_t typeIndex, SourceSpan span);
+    size_t addMember(MemberKind kind, SymbolId name, size_t sigBegin, int paramCount, uint64_t rva, uint64_t offset, uint64_t va,
+                     SourceSpan span = {});
+    size_t addMember(MemberKind kind, SymbolId name, std::string_view signature, int paramCount, uint64_t rva, uint64_t offset, uint64_t va,
+                     SourceSpan span = {});
+
+    // Concatenates parts column by column, freeing each part's column once copied, so merging stays close to the final
+    // model's size. typeBases receives each part's first type index.
+    static DumpModel concat(const std::vector<DumpModel*>& parts, std::vector<size_t>& typeBases);
+    void markMembersPending();
+    // Takes the members of body's first type as typeIndex's; members of adopted types need not be in type order.
+    void adoptMembers(size_t typeIndex, const DumpModel& body);
+    void reserve(size_t types, size_t members, size_t signatureBytes);
+    void clear();
+
+private:
+    std::string deferredSignature(size_t memberIndex) const;
+    size_t pushMember(MemberKind kind, SymbolId name, size_t sigBegin, int paramCount, uint64_t rva, uint64_t offset, uint64_t va,
+                      SourceSpan span);
+
+    size_t pendingTypes_ = 0;
+};
+
+inline MemberKind MemberView::kind() const { return model_->memberKinds[index_]; }
+inline SymbolId MemberView::name() const { return model_->memberNames[index_]; }
+inline std::string MemberView::signature() const { return model_->signature(index_); }
+inline int MemberView::paramCount() const { return model_->memberParamCounts[index_]; }
+inline uint64_t MemberView::rva() const { return model_->memberRvas[index_]; }
+inline uint64_t MemberView::offset() const { return model_->memberOffsets[index_]; }
+inline uint64_t MemberView::va() const { return model_->memberVas[index_]; }
+inline SourceSpan MemberView::sourceSpan() const { return {model_->memberSourceOffsets[index_], model_->memberSourceLengths[index_]}; }
+
+inline SymbolId TypeView::name() const { return model_->typeNames[index_]; }
+inline SymbolId TypeView::nameSpace() const { return model_->typeNamespaces[index_]; }
+inline SymbolId TypeView::assembly() const { return model_->assemblyFor(model_->typeDefIndices[index_]); }
+inline int TypeView::typeDefIndex() const { return model_->typeDefIndices[index_]; }
+inline bool TypeView::isEnum() const { return model_->typeIsEnum[index_] != 0; }
+inline SourceSpan TypeView::sourceSpan() const { return {model_->typeSourceOffsets[index_], model_->typeSourceLengths[index_]}; }
+inline size_t TypeView::memberBegin() const { return model_->typeMemberBegin[index_]; }
+inline size_t TypeView::memberCount() const { return model_->typeMemberEnd[index_] - model_->typeMemberBegin[index_]; }
@@ -0,0 +1,383 @@
+#include "ModelCache.h"
+
+#include "CompressedStream.h"
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+static constexpr char kMagic[8] = {'D', 'C', 'S', 'M', 'O', 'D', 'E', 'L'};
+static constexpr uint32_t kVersion = 5;
+static constexpr uint32_t kEndianTag = 0x01020304u;
+static constexpr const char* kExtension = ".dcm";
+static constexpr uint64_t kFlagSignaturesDeferred = 1;
+
+struct CacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t endianTag;
+    uint64_t sourceSize;
+    int64_t sourceMtime;
+    uint64_t contentHash;
+    uint64_t pathBytes;
+    uint64_t flags;
+};
+
+static fs::path toPath(const std::string& utf8) {
+    return fs::path(std::u8string(utf8.begin(), utf8.end()));
+}
+
+static std::string fromPath(const fs::path& p) {
+    const std::u8string s = p.u8string();
+    return std::string(s.begin(), s.end());
+}
+
+static uint64_t sampledHash(std::string_view data) {
+    constexpr size_t kEdgeBytes = 1u << 20;
+    constexpr size_t kBlockBytes = 64u << 10;
+    constexpr size_t kBlocks = 64;
+
+    uint64_t h = StringPool::hash({}) ^ data.size();
+    auto mix = [&h](std::string_view block) {
+        h = StringPool::hash(block) ^ (h * 0x100000001B3ull);
+    };
+
+    if (data.size() <= 2 * kEdgeBytes + kBlocks * kBlockBytes) {
+        mix(data);
+        return h;
+    }
+
+    mix(data.substr(0, kEdgeBytes));
+    const size_t middle = data.size() - 2 * kEdgeBytes - kBlockBytes;
+    for (size_t i = 0; i < kBlocks; ++i)
+        mix(data.substr(kEdgeBytes + middle * i / (kBlocks - 1), kBlockBytes));
+    mix(data.substr(data.size() - kEdgeBytes));
+    return h;
+}
+
+bool ModelCache::makeKey(const std::string& sourcePath, ModelCacheKey& out) {
+    std::error_code ec;
+    const fs::path p = toPath(sourcePath);
+    const fs::path abs = fs::absolute(p, ec);
+    if (ec)
+        return false;
+
+    const auto size = fs::file_size(p, ec);
+    if (ec)
+        return false;
+    const auto mtime = fs::last_write_time(p, ec);
+    if (ec)
+        return false;
+
+    MappedFile mapped;
+    if (!mapped.open(sourcePath))
+        return false;
+
+    out.path = fromPath(abs.lexically_normal());
+    out.size = (uint64_t)size;
+    out.mtime = (int64_t)mtime.time_since_epoch().count();
+    out.contentHash = sampledHash(mapped.view());
+    out.compressed = CompressedStream::detect(mapped.view()) != Compression::None;
+    return true;
+}
+
+std::string ModelCache::cacheFileFor(const std::string& cacheDir, const ModelCacheKey& key) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx", (unsigned long long)StringPool::hash(key.path));
+    return fromPath(toPath(cacheDir) / (std::string(name) + kExtension));
+}
+
+// Byte sinks for writeSnapshot: a file, a plain buffer, or a counter that sizes the buffer.
+struct FileSink {
+    std::ofstream& f;
+    void write(const void* data, uint64_t bytes) { f.write(static_cast<const char*>(data), (std::streamsize)bytes); }
+};
+
+struct BufferSink {
+    char* p;
+    void write(const void* data, uint64_t bytes) {
+        if (bytes)
+            std::memcpy(p, data, (size_t)bytes);
+        p += bytes;
+    }
+};
+
+struct CountingSink {
+    uint64_t bytes = 0;
+    void write(const void*, uint64_t n) { bytes += n; }
+};
+
+template <typename Sink>
+static void writePadding(Sink& out, uint64_t written) {
+    static const char zeros[8] = {};
+    if (written % 8)
+        out.write(zeros, 8 - written % 8);
+}
+
+template <typename Sink>
+static void writeBytes(Sink& out, const void* data, uint64_t bytes) {
+    out.write(&bytes, sizeof(bytes));
+    if (bytes)
+        out.write(data, bytes);
+    writePadding(out, bytes);
+}
+
+template <typename Sink, typename T>
+static void writeColumn(Sink& out, const std::vector<T>& v) {
+    writeBytes(out, v.data(), v.size() * sizeof(T));
+}
+
+template <typename Sink>
+static void writeSnapshot(Sink& out, const ModelCacheKey& key, const DumpModel& model) {
+    CacheHeader h{};
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.version = kVersion;
+    h.endianTag = kEndianTag;
+    h.sourceSize = key.size;
+    h.sourceMtime = key.mtime;
+    h.contentHash = key.contentHash;
+    h.pathBytes = key.path.size();
+    h.flags = model.signaturesDeferred ? kFlagSignaturesDeferred : 0;
+    out.write(&h, sizeof(h));
+    out.write(key.path.data(), key.path.size());
+    writePadding(out, key.path.size());
+
+    writeBytes(out, model.strings.chars().data(), model.strings.chars().size());
+    writeColumn(out, model.strings.offsets());
+    writeColumn(out, model.strings.hashSlots());
+    writeColumn(out, model.imageBases);
+    writeColumn(out, model.imageAssemblies);
+    writeColumn(out, model.typeNames);
+    writeColumn(out, model.typeNamespaces);
+    writeColumn(out, model.typeDefIndices);
+    writeColumn(out, model.typeIsEnum);
+    writeColumn(out, model.typeMemberBegin);
+    writeColumn(out, model.typeMemberEnd);
+    writeColumn(out, model.typeSourceOffsets);
+    writeColumn(out, model.typeSourceLengths);
+    writeColumn(out, model.memberKinds);
+    writeColumn(out, model.memberNames);
+    writeColumn(out, model.memberParamCounts);
+    writeColumn(out, model.memberSigOffsets);
+    writeColumn(out, model.memberSigLengths);
+    writeColumn(out, model.memberRvas);
+    writeColumn(out, model.memberOffsets);
+    writeColumn(out, model.memberVas);
+    writeColumn(out, model.memberSourceOffsets);
+    writeColumn(out, model.memberSourceLengths);
+    writeBytes(out, model.signatures.data(), model.signatures.size());
+}
+
+struct CacheReader {
+    const char* p;
+    const char* end;
+
+    bool take(uint64_t bytes, const char*& out) {
+        if ((uint64_t)(end - p) < bytes)
+            return false;
+        out = p;
+        p += bytes;
+        const uint64_t pad = (8 - bytes % 8) % 8;
+        p += std::min<uint64_t>(pad, (uint64_t)(end - p));
+        return true;
+    }
+
+    bool section(const char*& data, uint64_t& bytes) {
+        const char* lenPtr = nullptr;
+        if ((uint64_t)(end - p) < sizeof(uint64_t))
+            return false;
+        lenPtr = p;
+        p += sizeof(uint64_t);
+        std::memcpy(&bytes, lenPtr, sizeof(bytes));
+        return take(bytes, data);
+    }
+};
+
+template <typename T>
+static bool readColumn(CacheReader& r, std::vector<T>& v) {
+    const char* data = nullptr;
+    uint64_t bytes = 0;
+    if (!r.section(data, bytes) || bytes % sizeof(T) != 0)
+        return false;
+    v.resize((size_t)(bytes / sizeof(T)));
+    if (bytes)
+        std::memcpy(v.data(), data, (size_t)bytes);
+    return true;
+}
+
+static bool readString(CacheReader& r, std::string& s) {
+    const char* data = nullptr;
+    uint64_t bytes = 0;
+    if (!r.section(data, bytes))
+        return false;
+    s.assign(data, (size_t)bytes);
+    return true;
+}
+
+// Source spans are checked against the dump's size unless it is compressed, where they index the decompressed text.
+static bool validate(const DumpModel& m, const ModelCacheKey& key) {
+    const uint64_t sourceBytes = key.compressed ? UINT64_MAX : key.size;
+    auto spanOk = [sourceBytes](uint64_t offset, uint64_t length) {
+        return offset <= sourceBytes && length <= sourceBytes - offset;
+    };
+
+    const size_t types = m.typeNames.size();
+    const size_t members = m.memberKinds.size();
+    const size_t symbols = m.strings.size();
+
+    if (m.imageAssemblies.size() != m.imageBases.size())
+        return false;
+    for (size_t i = 0; i < m.imageCount(); ++i) {
+        if (m.imageAssemblies[i] >= symbols || (i > 0 && m.imageBases[i] <= m.imageBases[i - 1]))
+            return false;
+    }
+
+    if (m.typeNamespaces.size() != types || m.typeDefIndices.size() != types ||
+        m.typeIsEnum.size() != types || m.typeMemberBegin.size() != types || m.typeMemberEnd.size() != types ||
+        m.typeSourceOffsets.size() != types || m.typeSourceLengths.size() != types)
+        return false;
+    if (m.memberNames.size() != members || m.memberParamCounts.size() != members || m.memberSigOffsets.size() != members ||
+        m.memberSigLengths.size() != members || m.memberRvas.size() != members || m.memberOffsets.size() != members ||
+        m.memberVas.size() != members || m.memberSourceOffsets.size() != members || m.memberSourceLengths.size() != members)
+        return false;
+
+    for (size_t i = 0; i < types; ++i) {
+        if (m.typeNames[i] >= symbols || m.typeNamespaces[i] >= symbols)
+            return false;
+        if (m.typeMemberBegin[i] > m.typeMemberEnd[i] || m.typeMemberEnd[i] > members)
+            return false;
+        if (!spanOk(m.typeSourceOffsets[i], m.typeSourceLengths[i]))
+            return false;
+    }
+    for (size_t i = 0; i < members; ++i) {
+        if (m.memberNames[i] >= symbols || (uint8_t)m.memberKinds[i] > (uint8_t)MemberKind::EnumValue)
+            return false;
+        if (m.memberSigOffsets[i] > m.signatures.size() || m.memberSigLengths[i] > m.signatures.size() - m.memberSigOffsets[i])
+            return false;
+        if (!spanOk(m.memberSourceOffsets[i], m.memberSourceLengths[i]))
+            return false;
+    }
+    return true;
+}
+
+bool ModelCache::readImage(std::string_view image, const ModelCacheKey& key, DumpModel& out) {
+    if (image.size() < sizeof(CacheHeader))
+        return false;
+
+    CacheHeader h{};
+    std::memcpy(&h, image.data(), sizeof(h));
+    if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0 || h.version != kVersion || h.endianTag != kEndianTag)
+        return false;
+    if (h.sourceSize != key.size || h.sourceMtime != key.mtime || h.contentHash != key.contentHash)
+        return false;
+
+    CacheReader r{image.data() + sizeof(CacheHeader), image.data() + image.size()};
+    const char* pathData = nullptr;
+    if (!r.take(h.pathBytes, pathData) || std::string_view(pathData, (size_t)h.pathBytes) != key.path)
+        return false;
+
+    std::string chars;
+    std::vector<uint32_t> offsets;
+    std::vector<SymbolId> hashSlots;
+    DumpModel m;
+    const bool ok =
+        readString(r, chars) && readColumn(r, offsets) && readColumn(r, hashSlots) &&
+        readColumn(r, m.imageBases) && readColumn(r, m.imageAssemblies) &&
+        readColumn(r, m.typeNames) && readColumn(r, m.typeNamespaces) &&
+        readColumn(r, m.typeDefIndices) && readColumn(r, m.typeIsEnum) &&
+        readColumn(r, m.typeMemberBegin) && readColumn(r, m.typeMemberEnd) &&
+        readColumn(r, m.typeSourceOffsets) && readColumn(r, m.typeSourceLengths) &&
+        readColumn(r, m.memberKinds) && readColumn(r, m.memberNames) && readColumn(r, m.memberParamCounts) &&
+        readColumn(r, m.memberSigOffsets) && readColumn(r, m.memberSigLengths) &&
+        readColumn(r, m.memberRvas) && readColumn(r, m.memberOffsets) && readColumn(r, m.memberVas) &&
+        readColumn(r, m.memberSourceOffsets) && readColumn(r, m.memberSourceLengths) &&
+        readString(r, m.signatures);
+    if (!ok || !m.strings.restore(std::move(chars), std::move(offsets), std::move(hashSlots)) || !validate(m, key))
+        return false;
+    // The signature source is attached by the caller, which knows whether the file is still mappable.
+    m.signaturesDeferred = (h.flags & kFlagSignaturesDeferred) != 0;
+
+    out = std::move(m);
+    return true;
+}
+
+uint64_t ModelCache::imageSize(const ModelCacheKey& key, const DumpModel& model) {
+    CountingSink counter;
+    writeSnapshot(counter, key, model);
+    return counter.bytes;
+}
+
+void ModelCache::writeImage(char* out, const ModelCacheKey& key, const DumpModel& model) {
+    BufferSink sink{out};
+    writeSnapshot(sink, key, model);
+}
+
+bool ModelCache::load(const std::string& cacheFile, const ModelCacheKey& key, DumpModel& out) {
+    MappedFile mapped;
+    if (!mapped.open(cacheFile) || !readImage(mapped.view(), key, out))
+        return false;
+
+    std::error_code ec;
+    fs::last_write_time(toPath(cacheFile), fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+bool ModelCache::save(const std::string& cacheFile, const ModelCacheKey& key, const DumpModel& model) {
+    if (model.isSkeleton())
+        return false;
+
+    std::error_code ec;
+    const fs::path target = toPath(cacheFile);
+    fs::create_directories(target.parent_path(), ec);
+
+    fs::path tmp = target;
+    tmp += ".tmp";
+    {
+        std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+        if (!f.is_open())
+            return false;
+
+        FileSink sink{f};
+        writeSnapshot(sink, key, model);
+
+        f.flush();
+        if (!f) {
+            f.close();
+            fs::remove(tmp, ec);
+            return false;
+        }
+    }
+
+    fs::rename(tmp, target, ec);
+    if (ec) {
+        fs::remove(tmp, ec);
+        return false;
+    }
+    return true;
+}
+
+void ModelCache::prune(const std::string& cacheDir, size_t keep) {
+    std::error_code ec;
+    std::vector<std::pair<fs::file_time_type, fs::path>> files;
+    for (const auto& entry : fs::directory_iterator(toPath(cacheDir), ec)) {
+        if (entry.path().extension() != kExtension)
+            continue;
+        std::error_code timeEc;
+        const auto t = entry.last_write_time(timeEc);
+        if (!timeEc)
+            files.emplace_back(t, entry.path());
+    }
+    if (files.size() <= keep)
+        return;
+
+    std::sort(files.begin(), files.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+    for (size_t i = keep; i < files.size(); ++i)
+        fs::remove(files[i].second, ec);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+#include "DumpModel.h"
+
+struct ModelCacheKey {
+    std::string path;
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    uint64_t contentHash = 0;
+    // gzip/zstd source; spans then index the decompressed text.
+    bool compressed = false;
+};
+
+class ModelCache {
+public:
+    static bool makeKey(const std::string& sourcePath, ModelCacheKey& out);
+    static std::string cacheFileFor(const std::string& cacheDir, const ModelCacheKey& key);
+
+    static bool load(const std::string& cacheFile, const ModelCacheKey& key, DumpModel& out);
+    static bool save(const std::string& cacheFile, const ModelCacheKey& key, const DumpModel& model);
+    static void prune(const std::string& cacheDir, size_t keep);
+
+    // The same snapshot as an in-memory image, e.g. for handing a parsed model to another process.
+    static uint64_t imageSize(const ModelCacheKey& key, const DumpModel& model);
+    static void writeImage(char* out, const ModelCacheKey& key, const DumpModel& model);
+    static bool readImage(std::string_view image, const ModelCacheKey& key, DumpModel& out);
+};
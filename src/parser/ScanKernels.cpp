@@ -0,0 +1,363 @@
+#include "ScanKernels.h"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define DUMPCS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define DUMPCS_TARGET_AVX2
+#else
+#define DUMPCS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace ScanKernels {
+
+static inline int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static inline unsigned countTrailingZeros(unsigned v) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long idx = 0;
+    _BitScanForward(&idx, v);
+    return (unsigned)idx;
+#else
+    return (unsigned)__builtin_ctz(v);
+#endif
+}
+
+static inline unsigned countLeadingZeros(unsigned v) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long idx = 0;
+    _BitScanReverse(&idx, v);
+    return 31u - (unsigned)idx;
+#else
+    return (unsigned)__builtin_clz(v);
+#endif
+}
+
+static inline unsigned popCount(unsigned v) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return (unsigned)__popcnt(v);
+#else
+    return (unsigned)__builtin_popcount(v);
+#endif
+}
+
+static const char* findByteScalar(const char* b, const char* e, char c) {
+    const void* p = std::memchr(b, c, (size_t)(e - b));
+    return p ? static_cast<const char*>(p) : e;
+}
+
+static const char* findPairScalar(const char* b, const char* e, char c0, char c1) {
+    for (const char* p = b; p + 1 < e; ++p) {
+        p = static_cast<const char*>(std::memchr(p, c0, (size_t)(e - 1 - p)));
+        if (!p)
+            break;
+        if (p[1] == c1)
+            return p;
+    }
+    return e;
+}
+
+static const char* skipSpaceScalar(const char* b, const char* e) {
+    while (b < e && isSpace(*b))
+        ++b;
+    return b;
+}
+
+static const char* skipSpaceBackScalar(const char* b, const char* e) {
+    while (e > b && isSpace(e[-1]))
+        --e;
+    return e;
+}
+
+static size_t hexRunScalar(const char* b, const char* e) {
+    const char* p = b;
+    while (p < e && hexValue(*p) >= 0)
+        ++p;
+    return (size_t)(p - b);
+}
+
+static bool decodeHexScalar(const char* b, size_t n, uint64_t& out) {
+    out = 0;
+    if (n == 0)
+        return false;
+    size_t i = 0;
+    while (i + 1 < n && b[i] == '0')
+        ++i;
+    if (n - i > 16)
+        return false;
+    uint64_t v = 0;
+    for (; i < n; ++i) {
+        const int d = hexValue(b[i]);
+        if (d < 0)
+            return false;
+        v = (v << 4) | (uint64_t)d;
+    }
+    out = v;
+    return true;
+}
+
+static size_t countByteScalar(const char* b, const char* e, char c) {
+    size_t n = 0;
+    for (const char* p = b; p < e; ++p)
+        n += *p == c;
+    return n;
+}
+
+static size_t countPairScalar(const char* b, const char* e, char c0, char c1) {
+    size_t n = 0;
+    for (const char* p = b; p + 1 < e; ++p)
+        n += p[0] == c0 && p[1] == c1;
+    return n;
+}
+
+#ifdef DUMPCS_X86
+
+static inline __m128i spaceMask128(__m128i v) {
+    const __m128i sp = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+    const __m128i tab = _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'));
+    const __m128i cr = _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'));
+    const __m128i lf = _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'));
+    return _mm_or_si128(_mm_or_si128(sp, tab), _mm_or_si128(cr, lf));
+}
+
+static inline __m128i hexMask128(__m128i v) {
+    const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+    const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    const __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+    return _mm_or_si128(digit, alpha);
+}
+
+static const char* findByteSse2(const char* b, const char* e, char c) {
+    const __m128i needle = _mm_set1_epi8(c);
+    const char* p = b;
+    for (; p + 16 <= e; p += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const unsigned m = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle));
+        if (m)
+            return p + countTrailingZeros(m);
+    }
+    return findByteScalar(p, e, c);
+}
+
+static const char* findPairSse2(const char* b, const char* e, char c0, char c1) {
+    const __m128i n0 = _mm_set1_epi8(c0);
+    const __m128i n1 = _mm_set1_epi8(c1);
+    const char* p = b;
+    for (; p + 17 <= e; p += 16) {
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 1));
+        const unsigned m = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(v0, n0), _mm_cmpeq_epi8(v1, n1)));
+        if (m)
+            return p + countTrailingZeros(m);
+    }
+    return findPairScalar(p, e, c0, c1);
+}
+
+static const char* skipSpaceSse2(const char* b, const char* e) {
+    const char* p = b;
+    for (; p + 16 <= e; p += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const unsigned m = ~(unsigned)_mm_movemask_epi8(spaceMask128(v)) & 0xFFFFu;
+        if (m)
+            return p + countTrailingZeros(m);
+    }
+    return skipSpaceScalar(p, e);
+}
+
+static const char* skipSpaceBackSse2(const char* b, const char* e) {
+    const char* p = e;
+    for (; p - 16 >= b; p -= 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p - 16));
+        const unsigned m = ~(unsigned)_mm_movemask_epi8(spaceMask128(v)) & 0xFFFFu;
+        if (m)
+            return p - 16 + (32 - countLeadingZeros(m));
+    }
+    return skipSpaceBackScalar(b, p);
+}
+
+static size_t hexRunSse2(const char* b, const char* e) {
+    const char* p = b;
+    for (; p + 16 <= e; p += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const unsigned m = ~(unsigned)_mm_movemask_epi8(hexMask128(v)) & 0xFFFFu;
+        if (m)
+            return (size_t)(p - b) + countTrailingZeros(m);
+    }
+    return (size_t)(p - b) + hexRunScalar(p, e);
+}
+
+static size_t countByteSse2(const char* b, const char* e, char c) {
+    const __m128i needle = _mm_set1_epi8(c);
+    size_t n = 0;
+    const char* p = b;
+    for (; p + 16 <= e; p += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        n += popCount((unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle)));
+    }
+    return n + countByteScalar(p, e, c);
+}
+
+static size_t countPairSse2(const char* b, const char* e, char c0, char c1) {
+    const __m128i n0 = _mm_set1_epi8(c0);
+    const __m128i n1 = _mm_set1_epi8(c1);
+    size_t n = 0;
+    const char* p = b;
+    for (; p + 17 <= e; p += 16) {
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 1));
+        n += popCount((unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(v0, n0), _mm_cmpeq_epi8(v1, n1))));
+    }
+    return n + countPairScalar(p, e, c0, c1);
+}
+
+// The AVX2 kernels hand short inputs and tails to the SSE2 ones; clear the upper
+// YMM state first so the legacy-SSE code does not pay the transition penalty.
+DUMPCS_TARGET_AVX2 static const char* findByteAvx2(const char* b, const char* e, char c) {
+    if (e - b < 32)
+        return findByteSse2(b, e, c);
+    const __m256i needle = _mm256_set1_epi8(c);
+    const char* p = b;
+    for (; p + 32 <= e; p += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const unsigned m = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, needle));
+        if (m)
+            return p + countTrailingZeros(m);
+    }
+    _mm256_zeroupper();
+    return findByteSse2(p, e, c);
+}
+
+DUMPCS_TARGET_AVX2 static const char* findPairAvx2(const char* b, const char* e, char c0, char c1) {
+    if (e - b < 33)
+        return findPairSse2(b, e, c0, c1);
+    const __m256i n0 = _mm256_set1_epi8(c0);
+    const __m256i n1 = _mm256_set1_epi8(c1);
+    const char* p = b;
+    for (; p + 33 <= e; p += 32) {
+        const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 1));
+        const unsigned m = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(v0, n0), _mm256_cmpeq_epi8(v1, n1)));
+        if (m)
+            return p + countTrailingZeros(m);
+    }
+    _mm256_zeroupper();
+    return findPairSse2(p, e, c0, c1);
+}
+
+DUMPCS_TARGET_AVX2 static size_t countByteAvx2(const char* b, const char* e, char c) {
+    if (e - b < 32)
+        return countByteSse2(b, e, c);
+    const __m256i needle = _mm256_set1_epi8(c);
+    size_t n = 0;
+    const char* p = b;
+    for (; p + 32 <= e; p += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        n += popCount((unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, needle)));
+    }
+    _mm256_zeroupper();
+    return n + countByteSse2(p, e, c);
+}
+
+DUMPCS_TARGET_AVX2 static size_t countPairAvx2(const char* b, const char* e, char c0, char c1) {
+    if (e - b < 33)
+        return countPairSse2(b, e, c0, c1);
+    const __m256i n0 = _mm256_set1_epi8(c0);
+    const __m256i n1 = _mm256_set1_epi8(c1);
+    size_t n = 0;
+    const char* p = b;
+    for (; p + 33 <= e; p += 32) {
+        const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 1));
+        n += popCount((unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(v0, n0), _mm256_cmpeq_epi8(v1, n1))));
+    }
+    _mm256_zeroupper();
+    return n + countPairSse2(p, e, c0, c1);
+}
+
+DUMPCS_TARGET_AVX2 static bool decodeHexAvx2(const char* b, size_t n, uint64_t& out) {
+    size_t lead = 0;
+    while (lead + 1 < n && b[lead] == '0')
+        ++lead;
+    const size_t digits = n - lead;
+    if (n == 0 || digits > 16 || n < 16)
+        return decodeHexScalar(b, n, out);
+
+    // Right-align the significant digits in a 16-byte lane, padding with '0'.
+    const __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + n - 16));
+    const __m128i keep = _mm_cmpgt_epi8(_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm_set1_epi8((char)(15 - digits)));
+    const __m128i v = _mm_blendv_epi8(_mm_set1_epi8('0'), raw, keep);
+
+    if (_mm_movemask_epi8(hexMask128(v)) != 0xFFFF)
+        return false;
+
+    const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    const __m128i isAlpha = _mm_cmpgt_epi8(lower, _mm_set1_epi8('9'));
+    const __m128i nib = _mm_sub_epi8(_mm_sub_epi8(lower, _mm_set1_epi8('0')), _mm_and_si128(isAlpha, _mm_set1_epi8('a' - '0' - 10)));
+    const __m128i bytes = _mm_maddubs_epi16(nib, _mm_set1_epi16(0x0110));
+    const __m128i packed = _mm_packus_epi16(bytes, bytes);
+    uint64_t be = 0;
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(&be), packed);
+#if defined(_MSC_VER) && !defined(__clang__)
+    out = _byteswap_uint64(be);
+#else
+    out = __builtin_bswap64(be);
+#endif
+    return true;
+}
+
+static bool cpuHasAvx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4] = {};
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx)
+        return false;
+    if ((_xgetbv(0) & 0x6) != 0x6)
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif
+
+static KernelTable selectKernels() {
+#ifdef DUMPCS_X86
+    if (cpuHasAvx2())
+        return {Level::Avx2, findByteAvx2, findPairAvx2, skipSpaceSse2, skipSpaceBackSse2, hexRunSse2, decodeHexAvx2,
+                countByteAvx2, countPairAvx2};
+    return {Level::Sse2, findByteSse2, findPairSse2, skipSpaceSse2, skipSpaceBackSse2, hexRunSse2, decodeHexScalar,
+            countByteSse2, countPairSse2};
+#else
+    return {Level::Scalar, findByteScalar, findPairScalar, skipSpaceScalar, skipSpaceBackScalar, hexRunScalar, decodeHexScalar,
+            countByteScalar, countPairScalar};
+#endif
+}
+
+const KernelTable g_kernels = selectKernels();
+
+const char* levelName() {
+    switch (g_kernels.level) {
+    case Level::Avx2: return "AVX2";
+    case Level::Sse2: return "SSE2";
+    default: return "scalar";
+    }
+}
+
+}
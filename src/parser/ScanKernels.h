@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace ScanKernels {
+
+enum class Level {
+    Scalar,
+    Sse2,
+    Avx2
+};
+
+struct KernelTable {
+    Level level;
+    const char* (*findByte)(const char*, const char*, char);
+    const char* (*findPair)(const char*, const char*, char, char);
+    const char* (*skipSpace)(const char*, const char*);
+    const char* (*skipSpaceBack)(const char*, const char*);
+    size_t (*hexRun)(const char*, const char*);
+    bool (*decodeHex)(const char*, size_t, uint64_t&);
+    size_t (*countByte)(const char*, const char*, char);
+    size_t (*countPair)(const char*, const char*, char, char);
+};
+
+extern const KernelTable g_kernels;
+
+const char* levelName();
+
+inline Level activeLevel() {
+    return g_kernels.level;
+}
+
+inline bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+inline const char* findByte(const char* b, const char* e, char c) {
+    return g_kernels.findByte(b, e, c);
+}
+
+inline const char* findPair(const char* b, const char* e, char c0, char c1) {
+    return g_kernels.findPair(b, e, c0, c1);
+}
+
+inline const char* skipSpace(const char* b, const char* e) {
+    if (b < e && !isSpace(*b))
+        return b;
+    return g_kernels.skipSpace(b, e);
+}
+
+inline const char* skipSpaceBack(const char* b, const char* e) {
+    if (e > b && !isSpace(e[-1]))
+        return e;
+    return g_kernels.skipSpaceBack(b, e);
+}
+
+inline size_t hexRun(const char* b, const char* e) {
+    return g_kernels.hexRun(b, e);
+}
+
+inline bool decodeHex(const char* b, size_t n, uint64_t& out) {
+    return g_kernels.decodeHex(b, n, out);
+}
+
+inline size_t countByte(const char* b, const char* e, char c) {
+    return g_kernels.countByte(b, e, c);
+}
+
+// Occurrences of c0 immediately followed by c1.
+inline size_t countPair(const char* b, const char* e, char c0, char c1) {
+    return g_kernels.countPair(b, e, c0, c1);
+}
+
+}
@@ -0,0 +1,82 @@
+#include "SignatureCache.h"
+
+#include "DumpCsParser.h"
+
+#include <algorithm>
+#include <memory>
+
+bool SignatureCache::open(const std::string& sourcePath) {
+    for (Shard& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.recent.clear();
+        shard.byOffset.clear();
+        shard.bytes = 0;
+    }
+    if (!source_.open(sourcePath))
+        return false;
+    if (budget_ == 0)
+        budget_ = budgetFor(source_.size());
+    return true;
+}
+
+size_t SignatureCache::budgetFor(uint64_t sourceSize) {
+    constexpr uint64_t kMin = 16u << 20;
+    constexpr uint64_t kMax = 256u << 20;
+    return (size_t)std::clamp<uint64_t>(sourceSize / 16, kMin, kMax);
+}
+
+std::string SignatureCache::lookup(MemberKind kind, SourceSpan span) const {
+    if (!source_.isOpen() || span.offset > source_.size() || span.length > source_.size() - span.offset)
+        return {};
+
+    Shard& shard = shardFor(span.offset);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.byOffset.find(span.offset);
+        if (it != shard.byOffset.end()) {
+            shard.recent.splice(shard.recent.begin(), shard.recent, it->second);
+            return it->second->second;
+        }
+    }
+
+    std::string sig = decode(kind, span);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.byOffset.count(span.offset))
+        return sig;
+    shard.recent.emplace_front(span.offset, sig);
+    shard.byOffset[span.offset] = shard.recent.begin();
+    shard.bytes += entryBytes(sig);
+    const size_t shardBudget = std::max<size_t>(budget_ / kShards, 1);
+    while (shard.bytes > shardBudget && shard.recent.size() > 1) {
+        shard.bytes -= entryBytes(shard.recent.back().second);
+        shard.byOffset.erase(shard.recent.back().first);
+        shard.recent.pop_back();
+    }
+    return sig;
+}
+
+std::string SignatureCache::decode(MemberKind kind, SourceSpan span) const {
+    std::string sig;
+    if (source_.isOpen() && span.offset <= source_.size() && span.length <= source_.size() - span.offset)
+        DumpCsParser::decodeSignature(kind, source_.view().substr((size_t)span.offset, span.length), sig);
+    return sig;
+}
+
+size_t SignatureCache::size() const {
+    size_t n = 0;
+    for (Shard& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        n += shard.recent.size();
+    }
+    return n;
+}
+
+bool SignatureCache::attach(DumpModel& model, const std::string& sourcePath, size_t budgetBytes) {
+    auto cache = std::make_shared<SignatureCache>(budgetBytes);
+    if (!cache->open(sourcePath))
+        return false;
+    model.signaturesDeferred = true;
+    model.signatureSource = std::move(cache);
+    return true;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+
+#include "DumpModel.h"
+#include "MappedFile.h"
+
+// Decodes deferred member signatures from the mapped source on demand, keeping the most recent ones in a bounded LRU.
+// The LRU is split into shards with their own locks and is bounded by decoded bytes rather than entries.
+class SignatureCache {
+public:
+    // A budget of 0 picks one from the source size (budgetFor).
+    explicit SignatureCache(size_t budgetBytes = 0) : budget_(budgetBytes) {}
+
+    bool open(const std::string& sourcePath);
+
+    // Thread-safe; decodes outside the shard lock and returns a copy, so results never alias each other.
+    std::string lookup(MemberKind kind, SourceSpan span) const;
+    // Decodes without touching the LRU, for bulk passes over every member that would only evict what views use.
+    std::string decode(MemberKind kind, SourceSpan span) const;
+    size_t size() const;
+    size_t budget() const { return budget_; }
+
+    // A sixteenth of the source, within [16 MB, 256 MB]: enough for the members a view or a search touches on a 2 GB
+    // dump, while staying a small part of the memory an eager parse would have kept.
+    static size_t budgetFor(uint64_t sourceSize);
+
+    // Maps the model's source for lookups and marks it deferred; false, leaving the model unchanged, if the source
+    // cannot be mapped.
+    static bool attach(DumpModel& model, const std::string& sourcePath, size_t budgetBytes = 0);
+
+private:
+    static constexpr size_t kShards = 16;
+
+    using Entry = std::pair<uint64_t, std::string>;
+
+    struct Shard {
+        std::mutex mutex;
+        std::list<Entry> recent;
+        std::unordered_map<uint64_t, std::list<Entry>::iterator> byOffset;
+        size_t bytes = 0;
+    };
+
+    static size_t entryBytes(const std::string& sig) { return sig.size() + 64; }
+    Shard& shardFor(uint64_t offset) const { return shards_[(offset * 0x9E3779B97F4A7C15ull) >> 60]; }
+
+    MappedFile source_;
+    size_t budget_;
+    mutable Shard shards_[kShards];
+};
@@ -0,0 +1,112 @@
+#include "StringPool.h"
+
+#include <cstring>
+
+static constexpr SymbolId kNoSlot = 0xFFFFFFFFu;
+
+// Stable across runs and builds: slot tables are persisted by ModelCache.
+uint64_t StringPool::hash(std::string_view s) {
+    uint64_t h = 0x9E3779B97F4A7C15ull ^ s.size();
+    size_t i = 0;
+    for (; i + 8 <= s.size(); i += 8) {
+        uint64_t v = 0;
+        std::memcpy(&v, s.data() + i, 8);
+        h = (h ^ v) * 0xFF51AFD7ED558CCDull;
+        h ^= h >> 32;
+    }
+    uint64_t tail = 0;
+    if (i < s.size())
+        std::memcpy(&tail, s.data() + i, s.size() - i);
+    h = (h ^ tail) * 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 29;
+    return h;
+}
+
+static size_t hashOf(std::string_view s) {
+    return (size_t)StringPool::hash(s);
+}
+
+StringPool::StringPool() {
+    clear();
+}
+
+void StringPool::clear() {
+    chars_.clear();
+    offsets_.assign(2, 0);
+    slots_.assign(64, kNoSlot);
+    slots_[slotFor({}, hashOf({}))] = kEmpty;
+}
+
+size_t StringPool::slotFor(std::string_view s, size_t hash) const {
+    const size_t mask = slots_.size() - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        const SymbolId id = slots_[i];
+        if (id == kNoSlot || view(id) == s)
+            return i;
+    }
+}
+
+void StringPool::rehash(size_t slotCount) {
+    slots_.assign(slotCount, kNoSlot);
+    const size_t mask = slotCount - 1;
+    for (SymbolId id = 0; id < (SymbolId)size(); ++id) {
+        size_t i = hashOf(view(id)) & mask;
+        while (slots_[i] != kNoSlot)
+            i = (i + 1) & mask;
+        slots_[i] = id;
+    }
+}
+
+bool StringPool::find(std::string_view s, SymbolId& out) const {
+    const SymbolId id = slots_[slotFor(s, hashOf(s))];
+    if (id == kNoSlot)
+        return false;
+    out = id;
+    return true;
+}
+
+SymbolId StringPool::intern(std::string_view s) {
+    const size_t hash = hashOf(s);
+    size_t slot = slotFor(s, hash);
+    if (slots_[slot] != kNoSlot)
+        return slots_[slot];
+
+    if ((size() + 1) * 4 >= slots_.size() * 3) {
+        rehash(slots_.size() * 2);
+        slot = slotFor(s, hash);
+    }
+
+    const SymbolId id = (SymbolId)size();
+    chars_.append(s);
+    offsets_.push_back((uint32_t)chars_.size());
+    slots_[slot] = id;
+    return id;
+}
+
+void StringPool::reserve(size_t count, size_t bytes) {
+    chars_.reserve(bytes);
+    offsets_.reserve(count + 1);
+    size_t slotCount = slots_.size();
+    while ((count + 1) * 4 >= slotCount * 3)
+        slotCount *= 2;
+    if (slotCount != slots_.size())
+        rehash(slotCount);
+}
+
+bool StringPool::restore(std::string chars, std::vector<uint32_t> offsets, std::vector<SymbolId> hashSlots) {
+    if (offsets.size() < 2 || offsets.front() != 0 || offsets.back() != chars.size())
+        return false;
+    if (hashSlots.empty() || (hashSlots.size() & (hashSlots.size() - 1)) != 0 || offsets.size() - 1 >= hashSlots.size())
+        return false;
+    for (size_t i = 1; i < offsets.size(); ++i) {
+        if (offsets[i] < offsets[i - 1])
+            return false;
+    }
+    // Only the table's size is kept: a corrupt but in-range table could lack an empty slot and make slotFor() spin, so
+    // the slots are rebuilt from the strings.
+    const size_t slotCount = hashSlots.size();
+    chars_ = std::move(chars);
+    offsets_ = std::move(offsets);
+    rehash(slotCount);
+    return true;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+using SymbolId = uint32_t;
+
+class StringPool {
+public:
+    static constexpr SymbolId kEmpty = 0;
+
+    StringPool();
+
+    static uint64_t hash(std::string_view s);
+
+    SymbolId intern(std::string_view s);
+    bool find(std::string_view s, SymbolId& out) const;
+
+    std::string_view view(SymbolId id) const {
+        return {chars_.data() + offsets_[id], (size_t)(offsets_[id + 1] - offsets_[id])};
+    }
+
+    size_t size() const { return offsets_.size() - 1; }
+    size_t byteSize() const { return chars_.size(); }
+
+    void reserve(size_t count, size_t bytes);
+    void clear();
+
+    const std::string& chars() const { return chars_; }
+    const std::vector<uint32_t>& offsets() const { return offsets_; }
+    const std::vector<SymbolId>& hashSlots() const { return slots_; }
+    bool restore(std::string chars, std::vector<uint32_t> offsets, std::vector<SymbolId> hashSlots);
+
+private:
+    size_t slotFor(std::string_view s, size_t hash) const;
+    void rehash(size_t slotCount);
+
+    std::string chars_;
+    std::vector<uint32_t> offsets_;
+    std::vector<SymbolId> slots_;
+};
@@ -0,0 +1,100 @@
+#include "AddressIndex.h"
+
+#include <algorithm>
+#include <utility>
+
+void AddressIndex::clear() {
+    methods_.clear();
+    for (Table& table : tables_)
+        table = {};
+}
+
+void AddressIndex::build(const DumpModel& model) {
+    clear();
+    // Members of types adopted after a skeleton load need not follow type order, so the owning type is recorded here.
+    for (size_t t = 0; t < model.typeCount(); ++t) {
+        for (size_t m = model.typeMemberBegin[t]; m < model.typeMemberEnd[t]; ++m) {
+            const MemberKind kind = model.memberKinds[m];
+            if (kind == MemberKind::Method || kind == MemberKind::Ctor)
+                methods_.push_back({(uint32_t)m, (uint32_t)t});
+        }
+    }
+
+    const std::vector<uint64_t>* columns[3] = {&model.memberRvas, &model.memberOffsets, &model.memberVas};
+    std::vector<std::pair<uint64_t, uint32_t>> sorted;
+    for (size_t k = 0; k < 3; ++k) {
+        const std::vector<uint64_t>& addresses = *columns[k];
+        sorted.clear();
+        sorted.reserve(methods_.size());
+        for (uint32_t i = 0; i < (uint32_t)methods_.size(); ++i) {
+            // Abstract and extern methods have no body.
+            const uint64_t address = addresses[methods_[i].member];
+            if (address != 0)
+                sorted.emplace_back(address, i);
+        }
+        std::sort(sorted.begin(), sorted.end());
+
+        Table& table = tables_[k];
+        table.starts.reserve(sorted.size());
+        table.methods.reserve(sorted.size());
+        for (const auto& [address, method] : sorted) {
+            table.starts.push_back(address);
+            table.methods.push_back(method);
+        }
+    }
+}
+
+AddressIndex::Hit AddressIndex::hitAt(const Table& table, size_t pos) const {
+    const uint64_t start = table.starts[pos];
+    while (pos > 0 && table.starts[pos - 1] == start)
+        --pos;
+    const auto last = std::upper_bound(table.starts.begin() + (std::ptrdiff_t)pos, table.starts.end(), start);
+
+    const Method& method = methods_[table.methods[pos]];
+    Hit hit;
+    hit.start = start;
+    hit.member = method.member;
+    hit.type = method.type;
+    hit.aliases = (uint32_t)(last - table.starts.begin() - (std::ptrdiff_t)pos - 1);
+    return hit;
+}
+
+bool AddressIndex::resolve(AddressKind kind, uint64_t address, Hit& out) const {
+    const Table& table = tables_[(size_t)kind];
+    const auto it = std::upper_bound(table.starts.begin(), table.starts.end(), address);
+    if (it == table.starts.begin())
+        return false;
+    out = hitAt(table, (size_t)(it - table.starts.begin()) - 1);
+    return true;
+}
+
+void AddressIndex::resolveAll(AddressKind kind, const std::vector<uint64_t>& addresses, std::vector<Hit>& out) const {
+    const Table& table = tables_[(size_t)kind];
+    out.assign(addresses.size(), Hit{});
+
+    std::vector<uint32_t> order(addresses.size());
+    for (uint32_t i = 0; i < (uint32_t)order.size(); ++i)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return addresses[a] < addresses[b]; });
+
+    // pos counts the starts <= the current address; it only moves forward.
+    const size_t n = table.starts.size();
+    size_t pos = 0;
+    for (size_t i = 0; i < order.size(); ++i) {
+        const uint64_t address = addresses[order[i]];
+        if (i > 0 && address == addresses[order[i - 1]]) {
+            out[order[i]] = out[order[i - 1]];
+            continue;
+        }
+
+        size_t hi = pos;
+        for (size_t step = 1; hi < n && table.starts[hi] <= address; step *= 2) {
+            pos = hi + 1;
+            hi += step;
+        }
+        const auto bound = table.starts.begin() + (std::ptrdiff_t)std::min(hi, n);
+        pos = (size_t)(std::upper_bound(table.starts.begin() + (std::ptrdiff_t)pos, bound, address) - table.starts.begin());
+        if (pos > 0)
+            out[order[i]] = hitAt(table, pos - 1);
+    }
+}
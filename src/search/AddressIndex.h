@@ -0,0 +1,50 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <climits>
+
+#include "parser/DumpModel.h"
+
+enum class AddressKind : uint8_t { Rva, Offset, Va };
+
+// Methods and constructors sorted by start address, one table per address kind. Dumps carry no method sizes, so a
+// method is taken to extend up to the next method's start.
+class AddressIndex {
+public:
+    static constexpr uint32_t kNoMember = UINT32_MAX;
+
+    struct Hit {
+        uint64_t start = 0;
+        uint32_t member = kNoMember;
+        uint32_t type = 0;
+        // Further methods starting at the same address (identical code folded by the compiler).
+        uint32_t aliases = 0;
+    };
+
+    void build(const DumpModel& model);
+    void clear();
+
+    size_t methodCount() const { return methods_.size(); }
+    // The method with the greatest start <= address; false when the address precedes every method of that kind.
+    bool resolve(AddressKind kind, uint64_t address, Hit& out) const;
+    // Resolves a batch in one forward pass over the table, galloping between neighbouring addresses; out[i] belongs to
+    // addresses[i], with member kNoMember where nothing precedes the address.
+    void resolveAll(AddressKind kind, const std::vector<uint64_t>& addresses, std::vector<Hit>& out) const;
+
+private:
+    struct Method {
+        uint32_t member;
+        uint32_t type;
+    };
+
+    struct Table {
+        std::vector<uint64_t> starts;
+        std::vector<uint32_t> methods;
+    };
+
+    Hit hitAt(const Table& table, size_t pos) const;
+
+    std::vector<Method> methods_;
+    Table tables_[3];
+};
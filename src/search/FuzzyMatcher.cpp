@@ -0,0 +1,97 @@
+#include "FuzzyMatcher.h"
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+static constexpr int kMatch = 16;
+static constexpr int kBonusStart = 10;
+static constexpr int kBonusCamel = 9;
+static constexpr int kBonusDigit = 6;
+static constexpr int kConsecutive = 8;
+static constexpr int kGapStart = 3;
+static constexpr int kMaxLeadingPenalty = 15;
+static constexpr int kNone = INT_MIN / 2;
+
+static bool isLower(char c) { return c >= 'a' && c <= 'z'; }
+static bool isUpper(char c) { return c >= 'A' && c <= 'Z'; }
+static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+static bool isWordChar(char c) { return isLower(c) || isUpper(c) || isDigit(c); }
+static char fold(char c) { return isUpper(c) ? (char)(c - 'A' + 'a') : c; }
+
+// How much a match at text[j] is worth beyond kMatch: word starts, humps ("getPlayer", "HTTPServer"), digit runs.
+static int boundaryBonus(std::string_view text, size_t j) {
+    const char c = text[j];
+    if (j == 0)
+        return isWordChar(c) ? kBonusStart : 0;
+    const char prev = text[j - 1];
+    if (!isWordChar(prev))
+        return isWordChar(c) ? kBonusStart : 0;
+    if (isUpper(c) && (isLower(prev) || (isUpper(prev) && j + 1 < text.size() && isLower(text[j + 1]))))
+        return kBonusCamel;
+    if (isDigit(c) && !isDigit(prev))
+        return kBonusDigit;
+    return 0;
+}
+
+FuzzyMatcher::FuzzyMatcher(std::string_view query) {
+    for (char c : query) {
+        if (c != ' ' && c != '\t')
+            query_.push_back(fold(c));
+    }
+}
+
+bool FuzzyMatcher::score(std::string_view text, int& out) const {
+    const size_t m = query_.size();
+    const size_t n = text.size();
+    if (m == 0 || m > n)
+        return false;
+
+    // Cheap rejection before the alignment: the query must be a subsequence at all.
+    for (size_t i = 0, j = 0; i < m; ++j) {
+        if (j == n)
+            return false;
+        if (fold(text[j]) == query_[i])
+            ++i;
+    }
+
+    // prev[j]/cur[j]: best score with query_[i - 1]/query_[i] matched at text[j]. Gaps cost kGapStart plus one per
+    // skipped character, so the best predecessor across a gap is a running maximum of prev[k] + k.
+    thread_local std::vector<int> prev;
+    thread_local std::vector<int> cur;
+    prev.assign(n, kNone);
+    cur.assign(n, kNone);
+    for (size_t j = 0; j < n; ++j) {
+        if (fold(text[j]) == query_[0])
+            prev[j] = kMatch + 2 * boundaryBonus(text, j) - std::min<int>((int)j, kMaxLeadingPenalty);
+    }
+
+    for (size_t i = 1; i < m; ++i) {
+        int bestGap = kNone;
+        std::fill(cur.begin(), cur.end(), kNone);
+        for (size_t j = i; j < n; ++j) {
+            if (j >= 2 && prev[j - 2] != kNone)
+                bestGap = std::max(bestGap, prev[j - 2] + (int)(j - 2));
+            if (fold(text[j]) != query_[i])
+                continue;
+
+            const int bonus = boundaryBonus(text, j);
+            int best = kNone;
+            if (prev[j - 1] != kNone)
+                best = prev[j - 1] + kMatch + std::max(bonus, kConsecutive);
+            if (bestGap != kNone)
+                best = std::max(best, bestGap - (int)j + 1 - kGapStart + kMatch + bonus);
+            cur[j] = best;
+        }
+        prev.swap(cur);
+    }
+
+    int best = kNone;
+    for (size_t j = m - 1; j < n; ++j)
+        best = std::max(best, prev[j]);
+    if (best == kNone)
+        return false;
+
+    out = best * 64 - (int)std::min<size_t>(n, 63);
+    return true;
+}
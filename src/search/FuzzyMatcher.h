@@ -0,0 +1,22 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+// Subsequence matching for symbol names: every query character has to appear in order (ASCII case-insensitive), and the
+// best alignment is scored with bonuses for word starts, camel-case humps and consecutive runs, so "GPCtrl" ranks
+// GetPlayerController and "plyrhlth" ranks PlayerHealth near the top.
+class FuzzyMatcher {
+public:
+    explicit FuzzyMatcher(std::string_view query);
+
+    bool empty() const { return query_.empty(); }
+    // The query as matched: folded to lower case, without blanks.
+    const std::string& query() const { return query_; }
+
+    // Higher is better; shorter names win ties. False when the query is not a subsequence of text.
+    bool score(std::string_view text, int& out) const;
+
+private:
+    std::string query_;
+};
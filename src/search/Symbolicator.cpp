@@ -0,0 +1,78 @@
+#include "Symbolicator.h"
+
+static int hexDigit(char c) {
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+static bool isWordChar(char c) {
+    return hexDigit(c) >= 0 || (c >= 'g' && c <= 'z') || (c >= 'G' && c <= 'Z') || c == '_';
+}
+
+std::vector<AddressToken> Symbolicator::scan(std::string_view text) {
+    constexpr size_t kMaxDigits = 16;
+    constexpr size_t kMinBareDigits = 8;
+
+    std::vector<AddressToken> out;
+    size_t i = 0;
+    while (i < text.size()) {
+        if (!isWordChar(text[i])) {
+            ++i;
+            continue;
+        }
+        // One word at a time, so digits inside identifiers and longer hex runs never match.
+        size_t end = i;
+        while (end < text.size() && isWordChar(text[end]))
+            ++end;
+
+        size_t digits = i;
+        const bool prefixed = end - i > 2 && text[i] == '0' && (text[i + 1] == 'x' || text[i + 1] == 'X');
+        if (prefixed)
+            digits += 2;
+        size_t last = digits;
+        uint64_t value = 0;
+        while (last < end && hexDigit(text[last]) >= 0)
+            value = value << 4 | (uint64_t)hexDigit(text[last++]);
+
+        const size_t count = last - digits;
+        if (last == end && count > 0 && count <= kMaxDigits && (prefixed || count >= kMinBareDigits))
+            out.push_back({i, end - i, value});
+        i = end;
+    }
+    return out;
+}
+
+Symbolicator::Result Symbolicator::annotate(std::string_view text, const AddressIndex& index, AddressKind kind,
+                                            uint64_t imageBase, const Namer& name) {
+    const std::vector<AddressToken> tokens = scan(text);
+    std::vector<uint64_t> addresses;
+    addresses.reserve(tokens.size());
+    for (const AddressToken& token : tokens)
+        addresses.push_back(imageBase != 0 && token.value >= imageBase ? token.value - imageBase : token.value);
+
+    std::vector<AddressIndex::Hit> hits;
+    index.resolveAll(kind, addresses, hits);
+
+    Result result;
+    result.addresses = tokens.size();
+    result.text.reserve(text.size() + tokens.size() * 32);
+    size_t copied = 0;
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        const size_t end = tokens[i].offset + tokens[i].length;
+        result.text.append(text.substr(copied, end - copied));
+        copied = end;
+        if (hits[i].member == AddressIndex::kNoMember)
+            continue;
+        ++result.resolved;
+        result.text += " [";
+        result.text += name(hits[i], addresses[i]);
+        result.text += ']';
+    }
+    result.text.append(text.substr(copied));
+    return result;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "AddressIndex.h"
+
+struct AddressToken {
+    size_t offset = 0;
+    size_t length = 0;
+    uint64_t value = 0;
+};
+
+// Annotates the addresses in crash logs, backtraces and address lists with the methods containing them.
+class Symbolicator {
+public:
+    using Namer = std::function<std::string(const AddressIndex::Hit& hit, uint64_t address)>;
+
+    struct Result {
+        std::string text;
+        size_t addresses = 0;
+        size_t resolved = 0;
+    };
+
+    // 0x-prefixed hex literals, plus bare runs of 8 to 16 hex digits such as the "pc 0000000001a2b3c4" frames of
+    // Android tombstones. Longer runs (build IDs, hashes) are skipped.
+    static std::vector<AddressToken> scan(std::string_view text);
+
+    // Inserts " [name]" after every resolved address. With a nonzero imageBase, addresses at or above it are taken as
+    // absolute and rebased; smaller ones are already relative (e.g. "libil2cpp.so + 0x1a2b3c").
+    static Result annotate(std::string_view text, const AddressIndex& index, AddressKind kind, uint64_t imageBase,
+                           const Namer& name);
+};
@@ -0,0 +1,193 @@
+#include "TrigramIndex.h"
+
+#include <algorithm>
+#include <iterator>
+
+static constexpr uint32_t kNoSlot = UINT32_MAX;
+
+static uint32_t trigramKey(std::string_view s, size_t i) {
+    return (uint32_t)(uint8_t)s[i] << 16 | (uint32_t)(uint8_t)s[i + 1] << 8 | (uint8_t)s[i + 2];
+}
+
+// Distinct trigram keys of s, ascending.
+static void trigramsOf(std::string_view s, std::vector<uint32_t>& out) {
+    out.clear();
+    for (size_t i = 0; i + 3 <= s.size(); ++i)
+        out.push_back(trigramKey(s, i));
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+static size_t varintBytes(uint32_t v) {
+    size_t n = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        ++n;
+    }
+    return n;
+}
+
+std::string TrigramIndex::fold(std::string_view s) {
+    std::string out(s);
+    for (char& c : out)
+        c = fold(c);
+    return out;
+}
+
+void TrigramIndex::clear() {
+    folded_.clear();
+    textOffsets_.clear();
+    keys_.clear();
+    listCounts_.clear();
+    listStarts_.clear();
+    postings_.clear();
+}
+
+void TrigramIndex::build(const StringPool& strings) {
+    clear();
+    const size_t count = strings.size();
+    folded_.reserve(strings.byteSize());
+    textOffsets_.reserve(count + 1);
+    textOffsets_.push_back(0);
+    for (SymbolId id = 0; id < (SymbolId)count; ++id) {
+        for (char c : strings.view(id))
+            folded_.push_back(fold(c));
+        textOffsets_.push_back((uint32_t)folded_.size());
+    }
+
+    // Pass 1 sizes every list (ids arrive ascending, so delta widths are known up front); a dense key table maps
+    // trigrams to lists while building and is dropped afterwards.
+    std::vector<uint32_t> slotOf(1u << 24, kNoSlot);
+    std::vector<uint32_t> lastId;
+    std::vector<uint32_t> listBytes;
+    std::vector<uint32_t> keys;
+    for (SymbolId id = 0; id < (SymbolId)count; ++id) {
+        trigramsOf(folded(id), keys);
+        for (uint32_t key : keys) {
+            uint32_t& slot = slotOf[key];
+            if (slot == kNoSlot) {
+                slot = (uint32_t)listCounts_.size();
+                listCounts_.push_back(0);
+                lastId.push_back(0);
+                listBytes.push_back(0);
+            }
+            ++listCounts_[slot];
+            listBytes[slot] += (uint32_t)varintBytes(id - lastId[slot]);
+            lastId[slot] = id;
+        }
+    }
+
+    // Renumber the lists in key order so lookups can binary-search keys_.
+    const size_t lists = listCounts_.size();
+    std::vector<uint32_t> counts(lists);
+    keys_.resize(lists);
+    listStarts_.assign(lists + 1, 0);
+    uint32_t next = 0;
+    for (uint32_t key = 0; key < (1u << 24); ++key) {
+        uint32_t& slot = slotOf[key];
+        if (slot == kNoSlot)
+            continue;
+        keys_[next] = key;
+        counts[next] = listCounts_[slot];
+        listStarts_[next + 1] = listStarts_[next] + listBytes[slot];
+        slot = next++;
+    }
+    listCounts_ = std::move(counts);
+
+    std::vector<uint32_t> cursor(listStarts_.begin(), listStarts_.end() - 1);
+    std::fill(lastId.begin(), lastId.end(), 0);
+    postings_.resize(listStarts_.back());
+    for (SymbolId id = 0; id < (SymbolId)count; ++id) {
+        trigramsOf(folded(id), keys);
+        for (uint32_t key : keys) {
+            const uint32_t slot = slotOf[key];
+            uint32_t delta = id - lastId[slot];
+            lastId[slot] = id;
+            uint8_t* out = postings_.data() + cursor[slot];
+            while (delta >= 0x80) {
+                *out++ = (uint8_t)(delta | 0x80);
+                delta >>= 7;
+            }
+            *out++ = (uint8_t)delta;
+            cursor[slot] = (uint32_t)(out - postings_.data());
+        }
+    }
+}
+
+size_t TrigramIndex::memoryBytes() const {
+    return folded_.capacity() + postings_.capacity() +
+           (textOffsets_.capacity() + keys_.capacity() + listCounts_.capacity() + listStarts_.capacity()) * sizeof(uint32_t);
+}
+
+bool TrigramIndex::list(uint32_t key, size_t& slot) const {
+    const auto it = std::lower_bound(keys_.begin(), keys_.end(), key);
+    if (it == keys_.end() || *it != key)
+        return false;
+    slot = (size_t)(it - keys_.begin());
+    return true;
+}
+
+void TrigramIndex::decode(size_t slot, std::vector<SymbolId>& out) const {
+    out.clear();
+    out.reserve(listCounts_[slot]);
+    const uint8_t* p = postings_.data() + listStarts_[slot];
+    const uint8_t* end = postings_.data() + listStarts_[slot + 1];
+    SymbolId id = 0;
+    while (p < end) {
+        uint32_t delta = 0;
+        for (int shift = 0;; shift += 7) {
+            const uint8_t b = *p++;
+            delta |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80))
+                break;
+        }
+        id += delta;
+        out.push_back(id);
+    }
+}
+
+std::vector<SymbolId> TrigramIndex::find(std::string_view needle) const {
+    std::vector<SymbolId> out;
+    const std::string q = fold(needle);
+    if (q.empty())
+        return out;
+
+    if (q.size() < 3) {
+        for (SymbolId id = 0; id < (SymbolId)size(); ++id) {
+            if (folded(id).find(q) != std::string_view::npos)
+                out.push_back(id);
+        }
+        return out;
+    }
+
+    std::vector<uint32_t> keys;
+    trigramsOf(q, keys);
+    std::vector<size_t> slots;
+    slots.reserve(keys.size());
+    for (uint32_t key : keys) {
+        size_t slot = 0;
+        if (!list(key, slot))
+            return out;
+        slots.push_back(slot);
+    }
+    std::sort(slots.begin(), slots.end(), [this](size_t a, size_t b) { return listCounts_[a] < listCounts_[b]; });
+
+    // Lists much longer than the surviving candidates cost more to decode than verifying the candidates does.
+    constexpr size_t kMaxListRatio = 32;
+    decode(slots[0], out);
+    std::vector<SymbolId> ids;
+    std::vector<SymbolId> both;
+    for (size_t i = 1; i < slots.size() && !out.empty(); ++i) {
+        if (listCounts_[slots[i]] > out.size() * kMaxListRatio)
+            break;
+        decode(slots[i], ids);
+        both.clear();
+        std::set_intersection(out.begin(), out.end(), ids.begin(), ids.end(), std::back_inserter(both));
+        out.swap(both);
+    }
+
+    out.erase(std::remove_if(out.begin(), out.end(), [&](SymbolId id) {
+        return folded(id).find(q) == std::string_view::npos;
+    }), out.end());
+    return out;
+}
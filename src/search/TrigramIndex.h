@@ -0,0 +1,41 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "parser/StringPool.h"
+
+// Posting lists of ASCII case-folded byte trigrams over a string pool. find() intersects the lists of the needle's
+// trigrams, rarest first, and verifies the survivors against the folded text.
+class TrigramIndex {
+public:
+    void build(const StringPool& strings);
+    void clear();
+
+    // Ids of the strings containing needle (ASCII case-insensitive), ascending. Needles shorter than a trigram scan
+    // the folded text.
+    std::vector<SymbolId> find(std::string_view needle) const;
+
+    size_t size() const { return textOffsets_.empty() ? 0 : textOffsets_.size() - 1; }
+    std::string_view folded(SymbolId id) const {
+        return {folded_.data() + textOffsets_[id], (size_t)(textOffsets_[id + 1] - textOffsets_[id])};
+    }
+    size_t memoryBytes() const;
+
+    static char fold(char c) { return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c; }
+    static std::string fold(std::string_view s);
+
+private:
+    bool list(uint32_t key, size_t& slot) const;
+    void decode(size_t slot, std::vector<SymbolId>& out) const;
+
+    std::string folded_;
+    std::vector<uint32_t> textOffsets_;
+    // Sorted trigram keys; list i holds listCounts_[i] delta-varint ids in postings_[listStarts_[i], listStarts_[i + 1]).
+    std::vector<uint32_t> keys_;
+    std::vector<uint32_t> listCounts_;
+    std::vector<uint32_t> listStarts_;
+    std::vector<uint8_t> postings_;
+};
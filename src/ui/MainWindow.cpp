@@ -1,5 +1,13 @@
 #include "MainWindow.h"
+#include "parser/CompressedStream.h"
 #include "parser/DumpCsParser.h"
+#include "parser/MappedFile.h"
+#include "parser/ModelCache.h"
+#include "parser/SignatureCache.h"
+#include "search/AddressIndex.h"
+#include "search/FuzzyMatcher.h"
+#include "search/Symbolicator.h"
+#include "search/TrigramIndex.h"
 
 #include <QStackedWidget>
 #include <QTreeView>
@@ -27,6 +35,7 @@
 #include <QFrame>
 #include <QPixmap>
 #include <QFileInfo>
+#include <QThread>
 #include <QDir>
 #include <QCoreApplication>
 #include <QDialog>
@@ -43,6 +52,9 @@
 #include <QHash>
 #include <QSettings>
 #include <QStandardPaths>
+#include <QProcess>
+#include <QSharedMemory>
+#include <QUuid>
 #include <QtCore/qglobal.h>
 #include <unordered_set>
 #include <QBrush>
@@ -58,13 +70,22 @@
 #include <QtCore/qvariant.h>
 #include <QCloseEvent>
 
+#include <QThreadPool>
 #include <QTimer>
 
+#include <QtConcurrent/QtConcurrentMap>
 #include <QtConcurrent/QtConcurrentRun>
 #include <QFutureWatcher>
 
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <chrono>
 #include <map>
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
 
 static bool groupMatches(MemberKind mk, const QString& groupKey) {
     if (groupKey == "method")    return mk == MemberKind::Method;
@@ -76,28 +97,36 @@ static bool groupMatches(MemberKind mk, const QString& groupKey) {
     return false;
 }
 
-static QString bestMemberNameForSnippet(const DumpMember& m) {
-    const QString explicitName = QString::fromStdString(m.name).trimmed();
+static QString viewText(std::string_view s) {
+    return QString::fromUtf8(s.data(), (qsizetype)s.size());
+}
+
+static QString symbolText(const DumpModel& d, SymbolId id) {
+    return viewText(d.str(id));
+}
+
+static QString bestMemberNameForSnippet(const MemberView& m, const QString& name) {
+    const QString explicitName = name.trimmed();
     if (!explicitName.isEmpty())
         return explicitName;
 
-    const QString sig = QString::fromStdString(m.signature);
+    const QString sig = viewText(m.signature());
 
-    if (m.kind == MemberKind::Field || m.kind == MemberKind::EnumValue) {
+    if (m.kind() == MemberKind::Field || m.kind() == MemberKind::EnumValue) {
         static const QRegularExpression rx(R"(\b([A-Za-z_][A-Za-z0-9_]*)\b\s*(?:;|=))");
         const auto mm = rx.match(sig);
         if (mm.hasMatch())
             return mm.captured(1);
     }
 
-    if (m.kind == MemberKind::Property) {
+    if (m.kind() == MemberKind::Property) {
         static const QRegularExpression rx(R"(\b([A-Za-z_][A-Za-z0-9_]*)\b\s*\{)");
         const auto mm = rx.match(sig);
         if (mm.hasMatch())
             return mm.captured(1);
     }
 
-    if (m.kind == MemberKind::Event) {
+    if (m.kind() == MemberKind::Event) {
         static const QRegularExpression rx(R"(\bevent\s+[^\s]+\s+([A-Za-z_][A-Za-z0-9_]*)\b)");
         const auto mm = rx.match(sig);
         if (mm.hasMatch())
@@ -151,6 +180,682 @@ static QSettings appSettings() {
     return QSettings(snippetSettingsPath(), QSettings::IniFormat);
 }
 
+static QString modelCacheDir() {
+    return QFileInfo(snippetSettingsPath()).absolutePath() + "/cache";
+}
+
+// The out-of-process parse helper, when ParseOutOfProcess is set in [App] and the helper sits next to the executable.
+static QString parseHelperPath() {
+    QSettings s = appSettings();
+    s.beginGroup("App");
+    const bool enabled = s.value("ParseOutOfProcess", false).toBool();
+    s.endGroup();
+    if (!enabled)
+        return {};
+    return QStandardPaths::findExecutable("DumpCsParseHelper", {QCoreApplication::applicationDirPath()});
+}
+
+static bool readHelperSegment(const QString& segmentKey, qsizetype bytes, const std::string& source, DumpModel& out) {
+    ModelCacheKey key;
+    if (!ModelCache::makeKey(source, key))
+        return false;
+
+    QSharedMemory segment(segmentKey);
+    if (!segment.attach(QSharedMemory::ReadOnly))
+        return false;
+    const bool ok = segment.size() >= bytes &&
+                    ModelCache::readImage({static_cast<const char*>(segment.constData()), (size_t)bytes}, key, out);
+    segment.detach();
+    return ok;
+}
+
+// Runs the parse helper (src/helper/ParseHelper.cpp) and copies the model out of the segment it publishes. Called on a
+// worker thread; a failing or crashing helper surfaces as an exception, like a failing in-process parse.
+static DumpModel parseInHelper(const QString& helper, const std::string& source, const ParseOptions& options) {
+    const QString segmentKey = "DumpCsExplorer-" + QUuid::createUuid().toString(QUuid::WithoutBraces);
+    QStringList args{segmentKey, QString::fromStdString(source)};
+    if (options.deferSignatures)
+        args << "--defer";
+    for (const std::string& pattern : options.assemblies.include)
+        args << "--include" << QString::fromStdString(pattern);
+    for (const std::string& pattern : options.assemblies.exclude)
+        args << "--exclude" << QString::fromStdString(pattern);
+
+    QProcess proc;
+    proc.setProcessChannelMode(QProcess::ForwardedErrorChannel);
+    proc.start(helper, args);
+    if (!proc.waitForStarted())
+        throw std::runtime_error("Cannot start the parse helper: " + proc.errorString().toStdString());
+
+    DumpModel model;
+    bool received = false;
+    std::string error;
+    auto drain = [&]() {
+        while (proc.canReadLine()) {
+            const QByteArray line = proc.readLine().trimmed();
+            if (line.startsWith("progress ")) {
+                if (options.progress)
+                    options.progress(line.mid(9).toInt());
+            } else if (line.startsWith("ready ")) {
+                received = readHelperSegment(segmentKey, (qsizetype)line.mid(6).toLongLong(), source, model);
+                if (!received)
+                    error = "Cannot read the model published by the parse helper";
+                proc.closeWriteChannel();
+            } else if (line.startsWith("error ")) {
+                error = line.mid(6).toStdString();
+            }
+        }
+    };
+
+    while (proc.state() != QProcess::NotRunning) {
+        if (options.cancel.isCancelled()) {
+            proc.kill();
+            proc.waitForFinished();
+            return {};
+        }
+        proc.waitForReadyRead(100);
+        drain();
+    }
+    drain();
+
+    if (received) {
+        if (model.signaturesDeferred && !SignatureCache::attach(model, source))
+            throw std::runtime_error("Cannot map " + source + " to read member signatures");
+        return model;
+    }
+    if (proc.exitStatus() == QProcess::CrashExit)
+        throw std::runtime_error("The parse helper crashed");
+    if (error.empty())
+        error = "The parse helper exited with code " + std::to_string(proc.exitCode());
+    throw std::runtime_error(error);
+}
+
+static DumpModel parseDump(const std::string& source, const ParseOptions& options, const QString& helper) {
+    return helper.isEmpty() ? DumpCsParser::parse(source, options) : parseInHelper(helper, source, options);
+}
+
+static constexpr size_t kKeepCachedModels = 8;
+
+// A parsed comparison target, held until the loaded dump's member fill completes.
+struct PendingCompare {
+    DumpModel other;
+    QString path;
+};
+
+// Where a skeleton model is cached once its member fill completes; the key is taken when the parse starts.
+struct PendingCacheEntry {
+    std::string file;
+    ModelCacheKey key;
+};
+
+static DumpModel parseWithCache(const QString& path, const QString& cacheDir, bool* fromCache, const ParseOptions& options,
+                                const QString& helper = {}, PendingCacheEntry* pending = nullptr) {
+    const std::string source = path.toStdString();
+    // The cache holds complete models only.
+    if (!options.assemblies.empty())
+        return parseDump(source, options, helper);
+
+    ModelCacheKey key;
+    if (!ModelCache::makeKey(source, key))
+        return parseDump(source, options, helper);
+
+    const std::string cacheFile = ModelCache::cacheFileFor(cacheDir.toStdString(), key);
+    DumpModel model;
+    // A deferred snapshot whose source cannot be mapped would show blank signatures; parse again instead.
+    if (ModelCache::load(cacheFile, key, model) && (!model.signaturesDeferred || SignatureCache::attach(model, source))) {
+        if (fromCache) *fromCache = true;
+        return model;
+    }
+
+    model = parseDump(source, options, helper);
+    if (model.isSkeleton()) {
+        if (pending)
+            *pending = {cacheFile, key};
+    } else if (!model.empty()) {
+        ModelCache::save(cacheFile, key, model);
+        ModelCache::prune(cacheDir.toStdString(), kKeepCachedModels);
+    }
+    return model;
+}
+
+struct TypePreview {
+    QString assembly;
+    QString nameSpace;
+    QString name;
+    bool isEnum = false;
+};
+
+// Lock-free hand-off of type batches from the parse thread; the UI drains it on a timer.
+struct TypeBatchQueue {
+    struct Node {
+        std::vector<TypePreview> types;
+        Node* next = nullptr;
+    };
+
+    std::atomic<Node*> head{nullptr};
+
+    ~TypeBatchQueue() { takeAll(); }
+
+    void push(std::vector<TypePreview>&& types) {
+        auto* n = new Node{std::move(types), head.load(std::memory_order_relaxed)};
+        while (!head.compare_exchange_weak(n->next, n, std::memory_order_release, std::memory_order_relaxed)) {}
+    }
+
+    std::vector<std::vector<TypePreview>> takeAll() {
+        std::vector<std::vector<TypePreview>> out;
+        for (Node* n = head.exchange(nullptr, std::memory_order_acquire); n;) {
+            out.push_back(std::move(n->types));
+            Node* next = n->next;
+            delete n;
+            n = next;
+        }
+        std::reverse(out.begin(), out.end());
+        return out;
+    }
+};
+
+class TypePreviewVisitor final : public DumpVisitor {
+public:
+    explicit TypePreviewVisitor(std::shared_ptr<TypeBatchQueue> queue) : queue_(std::move(queue)) {}
+
+    void onType(const DumpTypeInfo& type) override {
+        if (type.assembly != lastAssembly_) {
+            lastAssembly_.assign(type.assembly);
+            assemblyText_ = viewText(type.assembly);
+        }
+        if (type.nameSpace != lastNamespace_) {
+            lastNamespace_.assign(type.nameSpace);
+            namespaceText_ = viewText(type.nameSpace);
+        }
+        batch_.push_back({assemblyText_, namespaceText_, viewText(type.name), type.isEnum});
+        if (batch_.size() >= kBatchSize)
+            flush();
+    }
+
+    void onEnd() override { flush(); }
+
+private:
+    static constexpr size_t kBatchSize = 2048;
+
+    void flush() {
+        if (batch_.empty())
+            return;
+        queue_->push(std::move(batch_));
+        batch_ = {};
+        batch_.reserve(kBatchSize);
+    }
+
+    std::shared_ptr<TypeBatchQueue> queue_;
+    std::vector<TypePreview> batch_;
+    std::string lastAssembly_;
+    std::string lastNamespace_;
+    QString assemblyText_;
+    QString namespaceText_;
+};
+
+// Results search terms are separated by whitespace or "::"; an entry matches when every term occurs in one of its
+// names (assembly, namespace, type or member) or, for members, in the signature, case-insensitively.
+static constexpr size_t kMaxSearchTerms = 32;
+// Matches beyond this many are counted but not listed.
+static constexpr int kMaxListedResults = 10000;
+// Fuzzy mode lists only the best-scoring matches.
+static constexpr size_t kMaxFuzzyResults = 1000;
+
+static QStringList searchTerms(const QString& query) {
+    static const QRegularExpression separators(R"(\s+|::)");
+    return query.split(separators, Qt::SkipEmptyParts);
+}
+
+// Display and detail text are derived from the model when shown, so entries stay small for millions of members.
+struct SearchEntry {
+    enum class Kind : uint8_t { Namespace, Type, Member } kind = Kind::Type;
+    MemberKind memberKind = MemberKind::Method;
+    SymbolId assembly = StringPool::kEmpty;
+    SymbolId ns = StringPool::kEmpty;
+    SymbolId typeName = StringPool::kEmpty;
+    // The type's name for type entries, the member's for member entries.
+    SymbolId name = StringPool::kEmpty;
+    int typeIndex = -1;
+    int memberIndex = -1;
+};
+
+// Case-folded member signatures, for terms no name of an entry contains (parameter and return types such as
+// "Vector3"). Eager models are copied, indexed like the model's members; deferred ones decode from their source on
+// each check, bypassing the signature LRU.
+struct SignatureText {
+    std::vector<uint32_t> typeMemberBegin;
+    std::string folded;
+    std::vector<uint64_t> offsets;
+    std::vector<uint32_t> lengths;
+    std::shared_ptr<const SignatureCache> source;
+    std::vector<MemberKind> kinds;
+    std::vector<uint64_t> spanOffsets;
+    std::vector<uint32_t> spanLengths;
+
+    void build(const DumpModel& model) {
+        typeMemberBegin = model.typeMemberBegin;
+        if (model.signaturesDeferred) {
+            source = model.signatureSource;
+            kinds = model.memberKinds;
+            spanOffsets = model.memberSourceOffsets;
+            spanLengths = model.memberSourceLengths;
+            return;
+        }
+        folded = TrigramIndex::fold(model.signatures);
+        offsets = model.memberSigOffsets;
+        lengths = model.memberSigLengths;
+    }
+
+    // The folded signature of a member entry; scratch holds it for deferred models.
+    std::string_view of(const SearchEntry& e, std::string& scratch) const {
+        if (e.typeIndex < 0 || (size_t)e.typeIndex >= typeMemberBegin.size())
+            return {};
+        const size_t m = typeMemberBegin[(size_t)e.typeIndex] + (size_t)e.memberIndex;
+        if (!source)
+            return m < offsets.size() ? std::string_view(folded.data() + offsets[m], lengths[m]) : std::string_view{};
+        if (m >= kinds.size())
+            return {};
+        scratch = source->decode(kinds[m], {spanOffsets[m], spanLengths[m]});
+        for (char& c : scratch)
+            c = TrigramIndex::fold(c);
+        return scratch;
+    }
+};
+
+struct SearchIndex {
+    std::vector<SearchEntry> entries;
+    // Names are either the parse-time labels, mapped to model symbols through nameSymbols, or a copy of the model's
+    // symbols (nameSymbols empty).
+    StringPool nameText;
+    TrigramIndex names;
+    std::vector<SymbolId> nameSymbols;
+    // Inverse of nameSymbols, for matching single entries while refining a query.
+    std::vector<SymbolId> symbolLabels;
+    size_t symbolCount = 0;
+    SignatureText signatures;
+
+    SymbolId labelOf(SymbolId symbol) const {
+        if (nameSymbols.empty())
+            return symbol < nameText.size() ? symbol : StringPool::kEmpty;
+        return symbol < symbolLabels.size() ? symbolLabels[symbol] : StringPool::kEmpty;
+    }
+};
+
+struct SearchQuery {
+    // Substring mode: every term has to occur in one of an entry's names or a member's signature. Fuzzy mode: pattern
+    // is scored against the entry's own name.
+    std::vector<std::string> terms;
+    std::string pattern;
+    bool fuzzy = false;
+
+    bool allowNs = true;
+    bool allowType = true;
+    bool allowMember[(size_t)MemberKind::EnumValue + 1] = {true, true, true, true, true, true};
+
+    int scopeMode = 0;
+    SymbolId scopeAssembly = StringPool::kEmpty;
+    SymbolId scopeNs = StringPool::kEmpty;
+    int scopeTypeIndex = -1;
+
+    // Workers give up once a newer request has been issued; their results would be dropped anyway.
+    std::shared_ptr<const std::atomic<int>> generation;
+    int requestId = 0;
+
+    bool stale() const { return generation && generation->load(std::memory_order_relaxed) != requestId; }
+
+    bool accepts(const SearchEntry& e) const {
+        if (e.kind == SearchEntry::Kind::Namespace) {
+            if (!allowNs)
+                return false;
+        } else if (e.kind == SearchEntry::Kind::Type) {
+            if (!allowType)
+                return false;
+        } else if (!allowMember[(size_t)e.memberKind]) {
+            return false;
+        }
+
+        switch (scopeMode) {
+        case 1: return e.assembly == scopeAssembly;
+        case 2: return e.assembly == scopeAssembly && e.ns == scopeNs;
+        case 3: return e.typeIndex == scopeTypeIndex;
+        default: return true;
+        }
+    }
+
+    // True when every entry this query matches is also matched by prev ("Pla" -> "Play", a kind filter turned off), so
+    // only prev's matches need to be looked at.
+    bool narrows(const SearchQuery& prev) const {
+        if (fuzzy != prev.fuzzy || scopeMode != prev.scopeMode || scopeAssembly != prev.scopeAssembly ||
+            scopeNs != prev.scopeNs || scopeTypeIndex != prev.scopeTypeIndex)
+            return false;
+        if ((allowNs && !prev.allowNs) || (allowType && !prev.allowType))
+            return false;
+        for (size_t k = 0; k < std::size(allowMember); ++k) {
+            if (allowMember[k] && !prev.allowMember[k])
+                return false;
+        }
+
+        if (fuzzy) {
+            // Subsequences of this pattern contain the previous one as a subsequence too.
+            const std::string was = FuzzyMatcher(prev.pattern).query();
+            const std::string now = FuzzyMatcher(pattern).query();
+            size_t i = 0;
+            for (size_t j = 0; i < was.size() && j < now.size(); ++j) {
+                if (was[i] == now[j])
+                    ++i;
+            }
+            return i == was.size();
+        }
+
+        // Each previous term must be implied by a term of this query.
+        for (const std::string& was : prev.terms) {
+            const std::string w = TrigramIndex::fold(was);
+            const bool implied = std::any_of(terms.begin(), terms.end(), [&w](const std::string& now) {
+                return TrigramIndex::fold(now).find(w) != std::string::npos;
+            });
+            if (!implied)
+                return false;
+        }
+        return true;
+    }
+};
+
+// A completed search, kept so the next query can refine it.
+struct SearchRefinement {
+    std::shared_ptr<const SearchIndex> index;
+    SearchQuery query;
+    QVector<int> matched;
+};
+
+// Entry indices in display order; total counts every match, including those past the listed ones.
+struct SearchResults {
+    QVector<int> indices;
+    qsizetype total = 0;
+    // Every match in index order.
+    QVector<int> matched;
+    // Set when the search ran to completion.
+    std::shared_ptr<const SearchRefinement> refinement;
+};
+
+// Upper bound on forEachShard's shard count, for sizing per-shard results.
+static size_t maxShards() {
+    return (size_t)std::max(1, QThreadPool::globalInstance()->maxThreadCount());
+}
+
+// Splits [0, count) into one contiguous shard per pool thread (none smaller than minShard) and runs fn(shard, begin,
+// end) on each through the global thread pool; the calling thread works through shards too, so this is safe from
+// inside a pool task. Returns the number of shards.
+template <typename F>
+static size_t forEachShard(size_t count, size_t minShard, const F& fn) {
+    const size_t shards = std::clamp<size_t>(count / std::max<size_t>(minShard, 1), 1, maxShards());
+    if (shards == 1) {
+        fn(0, 0, count);
+        return 1;
+    }
+    std::vector<size_t> ids(shards);
+    for (size_t i = 0; i < shards; ++i)
+        ids[i] = i;
+    QtConcurrent::blockingMap(ids, [&fn, shards, count](size_t i) { fn(i, count * i / shards, count * (i + 1) / shards); });
+    return shards;
+}
+
+// Entries between staleness checks in the scan loops.
+static constexpr size_t kStaleCheckMask = 0xFFF;
+
+static QVector<int> concatShards(const std::vector<QVector<int>>& shards, size_t count) {
+    qsizetype total = 0;
+    for (size_t shard = 0; shard < count; ++shard)
+        total += shards[shard].size();
+    QVector<int> out;
+    out.reserve(total);
+    for (size_t shard = 0; shard < count; ++shard)
+        out += shards[shard];
+    return out;
+}
+
+// Per-entry form of the name test, for refinements: a short candidate list is cheaper to check name by name than to
+// look every term up in the trigram index. Returns one bit per term found.
+static uint32_t entryTermHits(const SearchIndex& index, const SearchEntry& e, const std::vector<std::string>& folded) {
+    const SymbolId names[] = {e.assembly, e.ns, e.typeName, e.name};
+    const size_t count = e.kind == SearchEntry::Kind::Namespace ? 2 : 4;
+    uint32_t hit = 0;
+    for (size_t t = 0; t < folded.size(); ++t) {
+        for (size_t k = 0; k < count; ++k) {
+            if (index.names.folded(index.labelOf(names[k])).find(folded[t]) != std::string_view::npos) {
+                hit |= 1u << t;
+                break;
+            }
+        }
+    }
+    return hit;
+}
+
+// Checks the terms in missing (one bit per term) against a member's signature.
+static bool signatureHasTerms(const SearchIndex& index, const SearchEntry& e, const std::vector<std::string>& folded,
+                              uint32_t missing, std::string& scratch) {
+    if (e.kind != SearchEntry::Kind::Member)
+        return false;
+    const std::string_view sig = index.signatures.of(e, scratch);
+    for (size_t t = 0; t < folded.size(); ++t) {
+        if ((missing & (1u << t)) && sig.find(folded[t]) == std::string_view::npos)
+            return false;
+    }
+    return true;
+}
+
+// Scans every entry, or only candidates (the previous query's matches) when the query refines it.
+static SearchResults runSubstringSearch(const SearchQuery& query, const SearchIndex& index, const QVector<int>* candidates) {
+    constexpr size_t kMinShard = 1u << 15;
+
+    SearchResults out;
+
+    // One bit per term on every symbol whose text contains it.
+    std::vector<uint32_t> termHits;
+    std::vector<std::string> foldedTerms;
+    const uint32_t allTerms = query.terms.empty() ? 0 : (uint32_t)((1ull << query.terms.size()) - 1);
+    for (const std::string& term : query.terms)
+        foldedTerms.push_back(TrigramIndex::fold(term));
+    if (allTerms && !candidates) {
+        termHits.assign(index.symbolCount, 0);
+        for (size_t t = 0; t < query.terms.size(); ++t) {
+            if (query.stale())
+                return out;
+            for (SymbolId id : index.names.find(query.terms[t])) {
+                const SymbolId symbol = index.nameSymbols.empty() ? id : index.nameSymbols[id];
+                if (symbol < termHits.size())
+                    termHits[symbol] |= 1u << t;
+            }
+        }
+    }
+
+    // Shards are contiguous, so concatenating them in shard order keeps index order.
+    const size_t cores = maxShards();
+    std::vector<QVector<int>> found(cores);
+    const auto& entries = index.entries;
+    const size_t count = candidates ? (size_t)candidates->size() : entries.size();
+    const size_t shards = forEachShard(count, kMinShard, [&](size_t shard, size_t begin, size_t end) {
+        auto& hits = found[shard];
+        std::string scratch;
+        for (size_t pos = begin; pos < end; ++pos) {
+            if ((pos & kStaleCheckMask) == 0 && query.stale())
+                return;
+            const int i = candidates ? (*candidates)[(qsizetype)pos] : (int)pos;
+            const auto& e = entries[(size_t)i];
+            if (!query.accepts(e))
+                continue;
+
+            if (allTerms) {
+                uint32_t hit = 0;
+                if (candidates) {
+                    hit = entryTermHits(index, e, foldedTerms);
+                } else {
+                    hit = termHits[e.assembly] | termHits[e.ns];
+                    if (e.kind != SearchEntry::Kind::Namespace)
+                        hit |= termHits[e.typeName] | termHits[e.name];
+                }
+                if (hit != allTerms && !signatureHasTerms(index, e, foldedTerms, allTerms & ~hit, scratch))
+                    continue;
+            }
+
+            hits.push_back(i);
+        }
+    });
+
+    out.indices = concatShards(found, shards);
+    out.matched = out.indices;
+    out.total = out.indices.size();
+    return out;
+}
+
+// Scores every distinct name once, then keeps the best kMaxFuzzyResults entries per shard in a bounded heap and merges
+// the shards; ties keep index order. Refinements score the candidates' names directly instead.
+static SearchResults runFuzzySearch(const SearchQuery& query, const SearchIndex& index, const QVector<int>* candidates) {
+    constexpr int kNoScore = INT_MIN;
+    constexpr size_t kMinShard = 1u << 14;
+
+    SearchResults out;
+    const FuzzyMatcher matcher(query.pattern);
+    if (matcher.empty())
+        return runSubstringSearch(query, index, candidates);
+
+    std::vector<int> symbolScores;
+    if (!candidates) {
+        symbolScores.assign(index.symbolCount, kNoScore);
+        forEachShard(index.nameText.size(), kMinShard, [&](size_t, size_t begin, size_t end) {
+            for (size_t id = begin; id < end; ++id) {
+                if ((id & kStaleCheckMask) == 0 && query.stale())
+                    return;
+                const SymbolId symbol = index.nameSymbols.empty() ? (SymbolId)id : index.nameSymbols[id];
+                int score = 0;
+                if (symbol < symbolScores.size() && matcher.score(index.nameText.view((SymbolId)id), score))
+                    symbolScores[symbol] = score;
+            }
+        });
+    }
+
+    using Hit = std::pair<int, int>;
+    // Higher score first, then lower index; as a heap comparator it puts the worst kept hit on top.
+    auto better = [](const Hit& a, const Hit& b) { return a.first != b.first ? a.first > b.first : a.second < b.second; };
+    const size_t cores = maxShards();
+    std::vector<std::vector<Hit>> heaps(cores);
+    std::vector<QVector<int>> matched(cores);
+    const auto& entries = index.entries;
+    const size_t count = candidates ? (size_t)candidates->size() : entries.size();
+    const size_t shards = forEachShard(count, kMinShard, [&](size_t shard, size_t begin, size_t end) {
+        auto& heap = heaps[shard];
+        for (size_t pos = begin; pos < end; ++pos) {
+            if ((pos & kStaleCheckMask) == 0 && query.stale())
+                return;
+            const int i = candidates ? (*candidates)[(qsizetype)pos] : (int)pos;
+            const auto& e = entries[(size_t)i];
+            if (!query.accepts(e))
+                continue;
+            // Fields, properties and events carry the name they declare, so every member kind is scored by its own name.
+            const SymbolId name = e.kind == SearchEntry::Kind::Namespace ? e.ns : e.name;
+            int score = kNoScore;
+            if (candidates) {
+                if (!matcher.score(index.nameText.view(index.labelOf(name)), score))
+                    continue;
+            } else if ((score = symbolScores[name]) == kNoScore) {
+                continue;
+            }
+
+            matched[shard].push_back(i);
+            const Hit hit{score, i};
+            if (heap.size() < kMaxFuzzyResults) {
+                heap.push_back(hit);
+                std::push_heap(heap.begin(), heap.end(), better);
+            } else if (better(hit, heap.front())) {
+                std::pop_heap(heap.begin(), heap.end(), better);
+                heap.back() = hit;
+                std::push_heap(heap.begin(), heap.end(), better);
+            }
+        }
+    });
+
+    std::vector<Hit> merged;
+    for (size_t shard = 0; shard < shards; ++shard)
+        merged.insert(merged.end(), heaps[shard].begin(), heaps[shard].end());
+    std::sort(merged.begin(), merged.end(), better);
+    if (merged.size() > kMaxFuzzyResults)
+        merged.resize(kMaxFuzzyResults);
+    out.indices.reserve((qsizetype)merged.size());
+    for (const Hit& hit : merged)
+        out.indices.push_back(hit.second);
+    out.matched = concatShards(matched, shards);
+    out.total = out.matched.size();
+    return out;
+}
+
+// Search entries collected on the parse thread as chunks complete, so the index is ready along with the model.
+// Entry names are ids into labels until adoptSearchIndex maps them to the model's symbols.
+struct SearchIndexBuild {
+    ParseTimings timings;
+    ParseTimings::Clock::time_point firstEntry;
+    ParseTimings::Clock::time_point lastEntry;
+    std::vector<SearchEntry> entries;
+    StringPool labels;
+    TrigramIndex names;
+    AddressIndex addresses;
+    PendingCacheEntry cacheEntry;
+    size_t typeCount = 0;
+    bool adopted = false;
+};
+
+class SearchIndexVisitor final : public DumpVisitor {
+public:
+    explicit SearchIndexVisitor(SearchIndexBuild& build) : build_(build) {}
+
+    void onType(const DumpTypeInfo& type) override {
+        if (build_.typeCount == 0)
+            build_.firstEntry = ParseTimings::Clock::now();
+
+        type_ = SearchEntry{};
+        type_.kind = SearchEntry::Kind::Type;
+        type_.assembly = build_.labels.intern(type.assembly);
+        type_.ns = build_.labels.intern(type.nameSpace);
+        type_.typeName = build_.labels.intern(type.name);
+        type_.name = type_.typeName;
+        type_.typeIndex = (int)build_.typeCount++;
+        build_.entries.push_back(type_);
+        memberIndex_ = 0;
+    }
+
+    void onMember(const DumpMemberInfo& member) override {
+        SearchEntry em = type_;
+        em.kind = SearchEntry::Kind::Member;
+        em.name = build_.labels.intern(member.name);
+        em.memberIndex = memberIndex_++;
+        em.memberKind = member.kind;
+        build_.entries.push_back(em);
+    }
+
+    void onEnd() override {
+        build_.names.build(build_.labels);
+        build_.lastEntry = ParseTimings::Clock::now();
+    }
+
+private:
+    SearchIndexBuild& build_;
+    SearchEntry type_;
+    int memberIndex_ = 0;
+};
+
+class TeeVisitor final : public DumpVisitor {
+public:
+    TeeVisitor(DumpVisitor& first, DumpVisitor& second) : first_(first), second_(second) {}
+
+    void onImage(const DumpImageInfo& image) override { first_.onImage(image); second_.onImage(image); }
+    void onType(const DumpTypeInfo& type) override { first_.onType(type); second_.onType(type); }
+    void onMember(const DumpMemberInfo& member) override { first_.onMember(member); second_.onMember(member); }
+    void onTypeEnd(const SourceSpan& span) override { first_.onTypeEnd(span); second_.onTypeEnd(span); }
+    void onEnd() override { first_.onEnd(); second_.onEnd(); }
+
+private:
+    DumpVisitor& first_;
+    DumpVisitor& second_;
+};
+
 static QStringList loadRecentFiles() {
     QSettings s = appSettings();
     s.beginGroup("App");
@@ -166,6 +871,58 @@ static void saveRecentFiles(const QStringList& list) {
     s.endGroup();
 }
 
+// Size thresholds for big-dump modes, in MB under [App]; 0 disables the mode.
+static bool fileAtLeastSetting(const QString& path, const char* key, qint64 defaultMb) {
+    QSettings s = appSettings();
+    s.beginGroup("App");
+    const qint64 thresholdMb = s.value(key, defaultMb).toLongLong();
+    s.endGroup();
+    return thresholdMb > 0 && QFileInfo(path).size() >= thresholdMb * 1024 * 1024;
+}
+
+// Assembly include/exclude patterns under [App]; both empty loads everything.
+static void loadAssemblyPatterns(QStringList& include, QStringList& exclude) {
+    QSettings s = appSettings();
+    s.beginGroup("App");
+    include = s.value("AssemblyInclude").toStringList();
+    exclude = s.value("AssemblyExclude").toStringList();
+    s.endGroup();
+}
+
+static void saveAssemblyPatterns(const QStringList& include, const QStringList& exclude) {
+    QSettings s = appSettings();
+    s.beginGroup("App");
+    s.setValue("AssemblyInclude", include);
+    s.setValue("AssemblyExclude", exclude);
+    s.endGroup();
+}
+
+static QStringList splitPatterns(const QString& text) {
+    QStringList out;
+    for (const auto& part : text.split(QRegularExpression("[,;]"), Qt::SkipEmptyParts)) {
+        const QString p = part.trimmed();
+        if (!p.isEmpty())
+            out << p;
+    }
+    return out;
+}
+
+static AssemblyFilter makeAssemblyFilter(const QStringList& include, const QStringList& exclude) {
+    AssemblyFilter filter;
+    for (const auto& p : include)
+        filter.include.push_back(p.toStdString());
+    for (const auto& p : exclude)
+        filter.exclude.push_back(p.toStdString());
+    return filter;
+}
+
+static AssemblyFilter loadAssemblyFilter() {
+    QStringList include;
+    QStringList exclude;
+    loadAssemblyPatterns(include, exclude);
+    return makeAssemblyFilter(include, exclude);
+}
+
 static QString applySnippetTemplate(QString tpl, const QMap<QString, QString>& vars) {
     for (auto it = vars.begin(); it != vars.end(); ++it)
         tpl.replace(it.key(), it.value());
@@ -212,8 +969,8 @@ static QStringList validateSnippetPlaceholders(const QString& tpl) {
     return bad;
 }
 
-static QString normalizeSignature(const DumpMember& m) {
-    QString s = QString::fromStdString(m.signature).trimmed();
+static QString normalizeSignature(const MemberView& m, const QString& name) {
+    QString s = viewText(m.signature()).trimmed();
 
     static const QRegularExpression rxMods(
         R"(^(?:(?:public|private|protected|internal|static|virtual|override|abstract|sealed|extern|readonly|const|volatile|unsafe|new|partial|async|ref|out|in)\s+)+)"
@@ -223,7 +980,7 @@ static QString normalizeSignature(const DumpMember& m) {
     static const QRegularExpression rxGeneric(R"(<[^>]*>)");
     s.replace(rxGeneric, "<>");
 
-    if (m.kind == MemberKind::Method || m.kind == MemberKind::Ctor || m.kind == MemberKind::Property || m.kind == MemberKind::Event) {
+    if (m.kind() == MemberKind::Method || m.kind() == MemberKind::Ctor || m.kind() == MemberKind::Property || m.kind() == MemberKind::Event) {
         const int firstSpace = s.indexOf(' ');
         if (firstSpace > 0)
             s = s.mid(firstSpace + 1).trimmed();
@@ -232,8 +989,8 @@ static QString normalizeSignature(const DumpMember& m) {
         return s;
     }
 
-    if (m.kind == MemberKind::EnumValue)
-        return QString::fromStdString(m.name);
+    if (m.kind() == MemberKind::EnumValue)
+        return name;
 
     static const QRegularExpression rxFieldName(R"(\b([A-Za-z_][A-Za-z0-9_]*)\b\s*(?:;|=))");
     const auto mm = rxFieldName.match(s);
@@ -389,14 +1146,16 @@ public:
 
 class ResultsQueryHighlightDelegate final : public QStyledItemDelegate {
 public:
-    explicit ResultsQueryHighlightDelegate(QLineEdit* query, QObject* parent = nullptr)
-        : QStyledItemDelegate(parent), query_(query) {}
+    ResultsQueryHighlightDelegate(QLineEdit* query, QCheckBox* fuzzy, QObject* parent = nullptr)
+        : QStyledItemDelegate(parent), query_(query), fuzzy_(fuzzy) {}
 
     void paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const override {
         QStyleOptionViewItem opt(option);
         initStyleOption(&opt, index);
 
-        const QString q = query_ ? query_->text().trimmed() : QString();
+        // Fuzzy matches are scattered over the name, so only literal terms are highlighted.
+        const bool fuzzy = fuzzy_ && fuzzy_->isChecked();
+        const QString q = (query_ && !fuzzy) ? query_->text().trimmed() : QString();
         const QString text = opt.text;
 
         opt.text.clear();
@@ -442,11 +1201,21 @@ public:
         }
 
         const QString lowText = text.toLower();
-        const QString lowQ = q.toLower();
+        QStringList lowTerms;
+        for (const QString& term : searchTerms(q))
+            lowTerms << term.toLower();
 
         int pos = 0;
         while (pos < text.size()) {
-            const int hit = lowText.indexOf(lowQ, pos);
+            int hit = -1;
+            int hitLength = 0;
+            for (const QString& term : lowTerms) {
+                const int at = lowText.indexOf(term, pos);
+                if (at >= 0 && (hit < 0 || at < hit || (at == hit && term.size() > hitLength))) {
+                    hit = at;
+                    hitLength = (int)term.size();
+                }
+            }
             if (hit < 0) {
                 const QString tail = text.mid(pos);
                 drawSeg(fm.elidedText(tail, Qt::ElideRight, textRect.right() + 1 - x), baseText, false);
@@ -457,11 +1226,11 @@ public:
             if (!drawSeg(pre, baseText, false))
                 break;
 
-            const QString mid = text.mid(hit, lowQ.size());
+            const QString mid = text.mid(hit, hitLength);
             if (!drawSeg(mid, hlText, true))
                 break;
 
-            pos = hit + lowQ.size();
+            pos = hit + hitLength;
         }
 
         painter->restore();
@@ -469,64 +1238,148 @@ public:
 
 private:
     QLineEdit* query_ = nullptr;
+    QCheckBox* fuzzy_ = nullptr;
 };
 
+const QString& MainWindow::sym(SymbolId id) const {
+    return symbols_[id];
+}
+
+bool MainWindow::findSymbol(const QString& text, SymbolId& out) const {
+    if (text == "(unknown)") {
+        out = StringPool::kEmpty;
+        return true;
+    }
+    return dump_.strings.find(text.toStdString(), out);
+}
+
 void MainWindow::buildSearchIndex() {
-    searchIndex_.clear();
+    auto index = std::make_shared<SearchIndex>();
+    index->entries.reserve(nsItems_.size() + dump_.typeCount() + dump_.memberCount());
+    appendNamespaceEntries(index->entries);
 
-    size_t totalMembers = 0;
-    for (const auto& t : types_)
-        totalMembers += t.members.size();
+    for (int ti = 0; ti < (int)dump_.typeCount(); ++ti) {
+        const auto t = dump_.type((size_t)ti);
+        SearchEntry e;
+        e.kind = SearchEntry::Kind::Type;
+        e.assembly = t.assembly();
+        e.ns = t.nameSpace();
+        e.typeName = t.name();
+        e.name = t.name();
+        e.typeIndex = ti;
+        index->entries.push_back(e);
+
+        for (int mi = 0; mi < (int)t.memberCount(); ++mi) {
+            const auto m = t.member((size_t)mi);
+            SearchEntry em = e;
+            em.kind = SearchEntry::Kind::Member;
+            em.name = m.name();
+            em.memberIndex = mi;
+            em.memberKind = m.kind();
+            index->entries.push_back(em);
+        }
+    }
 
-    const bool indexMembers = totalMembers <= 250000;
-    if (!indexMembers)
-        statusBar()->showMessage("Large file detected: member search index disabled to prevent crashes (types/namespaces only)", 6000);
+    index->nameText = dump_.strings;
+    index->names.build(index->nameText);
+    index->symbolCount = dump_.strings.size();
+    index->signatures.build(dump_);
+    searchIndex_ = std::move(index);
+    lastSearch_.reset();
+}
 
+// Namespace entries come first, sorted by their detail text.
+void MainWindow::appendNamespaceEntries(std::vector<SearchEntry>& entries) const {
+    std::vector<std::pair<QString, SearchEntry>> namespaces;
+    namespaces.reserve(nsItems_.size());
     for (const auto& [key, item] : nsItems_) {
-        (void)item;
-        const auto pos = key.find('|');
-        const std::string asmName = (pos == std::string::npos) ? std::string() : key.substr(0, pos);
-        const std::string nsName = (pos == std::string::npos) ? key : key.substr(pos + 1);
-
         SearchEntry e;
         e.kind = SearchEntry::Kind::Namespace;
-        e.assembly = QString::fromStdString(asmName);
-        e.ns = QString::fromStdString(nsName);
-        e.display = e.ns;
-        e.detail = (e.assembly.isEmpty() ? QString() : (e.assembly + " :: ")) + e.ns;
-        searchIndex_.push_back(e);
+        e.assembly = key.first;
+        e.ns = key.second;
+        namespaces.emplace_back(searchDetail(e), e);
     }
+    std::sort(namespaces.begin(), namespaces.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (const auto& ns : namespaces)
+        entries.push_back(ns.second);
+}
 
-    for (int ti = 0; ti < (int)types_.size(); ++ti) {
-        const auto& t = types_[(size_t)ti];
-        SearchEntry e;
-        e.kind = SearchEntry::Kind::Type;
-        e.assembly = QString::fromStdString(t.assembly);
-        e.ns = QString::fromStdString(t.nameSpace);
-        e.typeIndex = ti;
-        const QString typeFqn = QString::fromStdString(t.nameSpace + "::" + t.name);
-        e.display = QString::fromStdString(t.name);
-        e.detail = (e.assembly.isEmpty() ? QString() : (e.assembly + " :: ")) + typeFqn;
-        searchIndex_.push_back(e);
-
-        if (indexMembers) {
-            for (int mi = 0; mi < (int)t.members.size(); ++mi) {
-                const auto& m = t.members[(size_t)mi];
-                SearchEntry em;
-                em.kind = SearchEntry::Kind::Member;
-                em.assembly = QString::fromStdString(t.assembly);
-                em.ns = QString::fromStdString(t.nameSpace);
-                em.typeIndex = ti;
-                em.memberIndex = mi;
-                em.memberKind = m.kind;
-                const QString memberDisp = QString::fromStdString(t.name + "  " + m.signature);
-                const QString memberFqn = QString::fromStdString(t.nameSpace + "::" + t.name + "  " + m.signature);
-                em.display = memberDisp;
-                em.detail = (em.assembly.isEmpty() ? QString() : (em.assembly + " :: ")) + memberFqn;
-                searchIndex_.push_back(em);
-            }
-        }
+QString MainWindow::searchDisplay(const SearchEntry& e) const {
+    if (e.kind != SearchEntry::Kind::Member)
+        return sym(e.kind == SearchEntry::Kind::Namespace ? e.ns : e.name);
+    return sym(e.typeName) + "  " + viewText(dump_.type((size_t)e.typeIndex).member((size_t)e.memberIndex).signature());
+}
+
+QString MainWindow::searchDetail(const SearchEntry& e) const {
+    if (e.kind == SearchEntry::Kind::Namespace)
+        return (e.assembly == StringPool::kEmpty ? QString("(unknown)") : sym(e.assembly)) + " :: " + sym(e.ns);
+
+    const QString& asmName = sym(e.assembly);
+    QString detail = (asmName.isEmpty() ? QString() : (asmName + " :: ")) + sym(e.ns) + "::" + sym(e.typeName);
+    if (e.kind == SearchEntry::Kind::Member)
+        detail += "  " + viewText(dump_.type((size_t)e.typeIndex).member((size_t)e.memberIndex).signature());
+    return detail;
+}
+
+// Takes over the entries built during the parse; false when they do not describe dump_ (cache hits, skeleton or
+// deferred loads), and buildSearchIndex has to run instead.
+bool MainWindow::adoptSearchIndex() {
+    SearchIndexBuild* build = indexBuild_.get();
+    if (!build || parseFromCache_ || dump_.isSkeleton() || dump_.signaturesDeferred || build->typeCount != dump_.typeCount())
+        return false;
+
+    std::vector<SymbolId> ids(build->labels.size(), StringPool::kEmpty);
+    for (SymbolId i = 0; i < (SymbolId)ids.size(); ++i) {
+        if (!dump_.strings.find(build->labels.view(i), ids[i]))
+            return false;
     }
+
+    auto index = std::make_shared<SearchIndex>();
+    index->entries.reserve(nsItems_.size() + build->entries.size());
+    appendNamespaceEntries(index->entries);
+    for (SearchEntry e : build->entries) {
+        e.assembly = ids[e.assembly];
+        e.ns = ids[e.ns];
+        e.typeName = ids[e.typeName];
+        e.name = ids[e.name];
+        index->entries.push_back(e);
+    }
+    index->nameText = std::move(build->labels);
+    index->names = std::move(build->names);
+    index->symbolLabels.assign(dump_.strings.size(), StringPool::kEmpty);
+    for (SymbolId label = 0; label < (SymbolId)ids.size(); ++label)
+        index->symbolLabels[ids[label]] = label;
+    index->nameSymbols = std::move(ids);
+    index->symbolCount = dump_.strings.size();
+    index->signatures.build(dump_);
+    searchIndex_ = std::move(index);
+    lastSearch_.reset();
+
+    build->entries = {};
+    build->adopted = true;
+    return true;
+}
+
+// Offsets from the start of the open at which each stage finished, e.g. " (read 0.70 s, parse 1.31 s, ...)".
+QString MainWindow::stageTimingsText() const {
+    using Clock = ParseTimings::Clock;
+    const SearchIndexBuild* build = indexBuild_.get();
+    if (!build || build->timings.start == Clock::time_point{})
+        return {};
+
+    const auto& t = build->timings;
+    auto secs = [&t](Clock::time_point at) {
+        return QString::number(std::chrono::duration<double>(at - t.start).count(), 'f', 2);
+    };
+    QStringList parts;
+    if (t.readEnd != Clock::time_point{})
+        parts << "read " + secs(t.readEnd) + " s";
+    if (t.parseEnd != Clock::time_point{})
+        parts << "parse " + secs(t.parseEnd) + " s";
+    if (build->adopted && build->firstEntry != Clock::time_point{})
+        parts << "index " + secs(build->firstEntry) + "–" + secs(build->lastEntry) + " s";
+    parts << "ready " + secs(Clock::now()) + " s";
+    return " (" + parts.join(", ") + ")";
 }
 
 void MainWindow::updateSearchResults() {
@@ -546,27 +1399,31 @@ void MainWindow::updateSearchResults() {
 
 
     if (!resultsFilterWatcher_) {
-        resultsFilterWatcher_ = new QFutureWatcher<QVector<int>>(this);
-        connect(resultsFilterWatcher_, &QFutureWatcher<QVector<int>>::finished, this, [this]() {
+        resultsFilterWatcher_ = new QFutureWatcher<SearchResults>(this);
+        connect(resultsFilterWatcher_, &QFutureWatcher<SearchResults>::finished, this, [this]() {
             const int req = resultsFilterWatcher_->property("requestId").toInt();
-            if (req != resultsFilterRequestId_)
+            if (req != resultsFilterRequestId_->load())
                 return;
 
-            const QVector<int> indices = resultsFilterWatcher_->result();
+            const SearchResults results = resultsFilterWatcher_->result();
+            lastSearch_ = results.refinement;
+            const QVector<int>& indices = results.indices;
+            const int entryCount = searchIndex_ ? (int)searchIndex_->entries.size() : 0;
+            const int listed = std::min<int>((int)indices.size(), kMaxListedResults);
             resultsList_->setUpdatesEnabled(false);
             resultsList_->clear();
-            for (int i : indices) {
-                if (i < 0 || i >= (int)searchIndex_.size())
+            for (int i : indices.mid(0, listed)) {
+                if (i < 0 || i >= entryCount)
                     continue;
-                const auto& e = searchIndex_[(size_t)i];
-                auto* it = new QListWidgetItem(e.display, resultsList_);
-                it->setToolTip(e.detail);
+                const auto& e = searchIndex_->entries[(size_t)i];
+                auto* it = new QListWidgetItem(searchDisplay(e), resultsList_);
+                it->setToolTip(searchDetail(e));
                 if (e.kind == SearchEntry::Kind::Namespace) {
                     it->setIcon(icoNamespace_);
                 } else if (e.kind == SearchEntry::Kind::Type) {
                     bool isEnum = false;
-                    if (e.typeIndex >= 0 && (size_t)e.typeIndex < types_.size())
-                        isEnum = types_[(size_t)e.typeIndex].isEnum;
+                    if (e.typeIndex >= 0 && (size_t)e.typeIndex < dump_.typeCount())
+                        isEnum = dump_.type((size_t)e.typeIndex).isEnum();
                     it->setIcon(isEnum ? icoEnumType_ : icoClass_);
                     it->setForeground(isEnum ? QBrush(QColor(160, 110, 255)) : QBrush(QColor(80, 160, 255)));
                 } else {
@@ -583,23 +1440,31 @@ void MainWindow::updateSearchResults() {
                 it->setData(Qt::UserRole + 1, i);
             }
             resultsList_->setUpdatesEnabled(true);
-            if (resultsCount_)
-                resultsCount_->setText(QString::number(indices.size()));
+            if (resultsCount_) {
+                // Skeleton loads list members once the background fill completes; afterMembersAdopted searches again.
+                resultsCount_->setText((listed < results.total
+                    ? QString("%1 of %2").arg(listed).arg(results.total)
+                    : QString::number(results.total)) + (dump_.isSkeleton() ? QString(" (members loading)") : QString()));
+            }
         });
     }
 
     const int scopeMode = resultsScope_ ? resultsScope_->currentIndex() : 0;
-    QString scopeAssembly;
-    QString scopeNs;
+    SymbolId scopeAssembly = StringPool::kEmpty;
+    SymbolId scopeNs = StringPool::kEmpty;
+    bool hasScopeAssembly = false;
+    bool hasScopeNs = false;
     int scopeTypeIndex = -1;
     bool scopeValid = (scopeMode == 0);
 
     auto fillFromTypeIndex = [&](int ti) {
-        if (ti < 0 || (size_t)ti >= types_.size())
+        if (ti < 0 || (size_t)ti >= dump_.typeCount())
             return false;
-        const auto& t = types_[(size_t)ti];
-        scopeAssembly = QString::fromStdString(t.assembly);
-        scopeNs = QString::fromStdString(t.nameSpace);
+        const auto t = dump_.type((size_t)ti);
+        scopeAssembly = t.assembly();
+        scopeNs = t.nameSpace();
+        hasScopeAssembly = true;
+        hasScopeNs = true;
         scopeTypeIndex = ti;
         return true;
     };
@@ -639,13 +1504,13 @@ void MainWindow::updateSearchResults() {
                 const QString parentName = idx.parent().data(Qt::UserRole + 100).toString();
                 if (!curName.isEmpty()) {
                     if (parentName == "Assemblies") {
-                        scopeAssembly = curName;
-                        scopeNs.clear();
+                        hasScopeAssembly = findSymbol(curName, scopeAssembly);
+                        hasScopeNs = false;
                         scopeTypeIndex = -1;
                         scopeValid = true;
                     } else if (!parentName.isEmpty()) {
-                        scopeAssembly = parentName;
-                        scopeNs = curName;
+                        hasScopeAssembly = findSymbol(parentName, scopeAssembly);
+                        hasScopeNs = findSymbol(curName, scopeNs);
                         scopeTypeIndex = -1;
                         scopeValid = true;
                     }
@@ -654,73 +1519,58 @@ void MainWindow::updateSearchResults() {
         }
 
         if (scopeMode == 1) {
-            scopeNs.clear();
+            hasScopeNs = false;
             scopeTypeIndex = -1;
-            scopeValid = !scopeAssembly.isEmpty();
+            scopeValid = hasScopeAssembly;
         } else if (scopeMode == 2) {
             scopeTypeIndex = -1;
-            scopeValid = !scopeAssembly.isEmpty() && !scopeNs.isEmpty();
+            scopeValid = hasScopeAssembly && hasScopeNs;
         } else if (scopeMode == 3) {
             scopeValid = scopeTypeIndex >= 0;
         }
     }
 
-    ++resultsFilterRequestId_;
-    const int requestId = resultsFilterRequestId_;
+    const int requestId = ++*resultsFilterRequestId_;
     resultsFilterWatcher_->setProperty("requestId", requestId);
 
-    const auto indexSnapshot = &searchIndex_;
-    QFuture<QVector<int>> fut = QtConcurrent::run([=]() {
-        QVector<int> out;
-        out.reserve((int)indexSnapshot->size());
-
-        if (scopeMode != 0 && !scopeValid) {
-            out.squeeze();
-            return out;
-        }
-
-        const QString qTrim = q.trimmed();
-        for (int i = 0; i < (int)indexSnapshot->size(); ++i) {
-            const auto& e = (*indexSnapshot)[(size_t)i];
-
-            bool kindOk = false;
-            if (e.kind == SearchEntry::Kind::Namespace) kindOk = allowNs;
-            else if (e.kind == SearchEntry::Kind::Type) kindOk = allowType;
-            else {
-                switch (e.memberKind) {
-                case MemberKind::Method: kindOk = allowMethod; break;
-                case MemberKind::Ctor: kindOk = allowCtor; break;
-                case MemberKind::Field: kindOk = allowField; break;
-                case MemberKind::Property: kindOk = allowProperty; break;
-                case MemberKind::Event: kindOk = allowEvent; break;
-                case MemberKind::EnumValue: kindOk = allowEnumValue; break;
-                }
-            }
-            if (!kindOk)
-                continue;
-
-            if (scopeMode == 1) {
-                if (e.assembly != scopeAssembly)
-                    continue;
-            } else if (scopeMode == 2) {
-                if (e.assembly != scopeAssembly || e.ns != scopeNs)
-                    continue;
-            } else if (scopeMode == 3) {
-                if (e.typeIndex != scopeTypeIndex)
-                    continue;
-            }
-
-            if (!qTrim.isEmpty()) {
-                const bool hit = e.display.contains(qTrim, Qt::CaseInsensitive) || e.detail.contains(qTrim, Qt::CaseInsensitive);
-                if (!hit)
-                    continue;
-            }
-
-            out.push_back(i);
-        }
-
-        out.squeeze();
-        return out;
+    SearchQuery query;
+    query.fuzzy = resultsFuzzy_ && resultsFuzzy_->isChecked();
+    if (query.fuzzy) {
+        query.pattern = q.toStdString();
+    } else {
+        for (const QString& term : searchTerms(q))
+            query.terms.push_back(term.toStdString());
+        if (query.terms.size() > kMaxSearchTerms)
+            query.terms.resize(kMaxSearchTerms);
+    }
+    query.allowNs = allowNs;
+    query.allowType = allowType;
+    query.allowMember[(size_t)MemberKind::Method] = allowMethod;
+    query.allowMember[(size_t)MemberKind::Ctor] = allowCtor;
+    query.allowMember[(size_t)MemberKind::Field] = allowField;
+    query.allowMember[(size_t)MemberKind::Property] = allowProperty;
+    query.allowMember[(size_t)MemberKind::Event] = allowEvent;
+    query.allowMember[(size_t)MemberKind::EnumValue] = allowEnumValue;
+    query.scopeMode = scopeMode;
+    query.scopeAssembly = scopeAssembly;
+    query.scopeNs = scopeNs;
+    query.scopeTypeIndex = scopeTypeIndex;
+    query.generation = resultsFilterRequestId_;
+    query.requestId = requestId;
+
+    // Refinements of the last completed search only look at its matches.
+    std::shared_ptr<const SearchRefinement> previous;
+    if (lastSearch_ && lastSearch_->index == searchIndex_ && query.narrows(lastSearch_->query))
+        previous = lastSearch_;
+
+    QFuture<SearchResults> fut = QtConcurrent::run([query, index = searchIndex_, previous, scopeOk = scopeMode == 0 || scopeValid]() {
+        if (!index || !scopeOk || query.stale())
+            return SearchResults{};
+        const QVector<int>* candidates = previous ? &previous->matched : nullptr;
+        SearchResults results = query.fuzzy ? runFuzzySearch(query, *index, candidates) : runSubstringSearch(query, *index, candidates);
+        if (!query.stale())
+            results.refinement = std::make_shared<const SearchRefinement>(SearchRefinement{index, query, results.matched});
+        return results;
     });
 
     resultsFilterWatcher_->setFuture(fut);
@@ -730,10 +1580,10 @@ void MainWindow::navigateToSearchResult(QListWidgetItem* item) {
     if (!item)
         return;
     const int idx = item->data(Qt::UserRole + 1).toInt();
-    if (idx < 0 || idx >= (int)searchIndex_.size())
+    if (!searchIndex_ || idx < 0 || idx >= (int)searchIndex_->entries.size())
         return;
 
-    const auto& e = searchIndex_[(size_t)idx];
+    const SearchEntry e = searchIndex_->entries[(size_t)idx];
 
     auto expandProxyAncestors = [this](QModelIndex pidx) {
         for (QModelIndex cur = pidx; cur.isValid(); cur = cur.parent())
@@ -742,8 +1592,7 @@ void MainWindow::navigateToSearchResult(QListWidgetItem* item) {
 
     QStandardItem* target = nullptr;
     if (e.kind == SearchEntry::Kind::Namespace) {
-        const std::string key = e.assembly.toStdString() + "|" + e.ns.toStdString();
-        auto it = nsItems_.find(key);
+        auto it = nsItems_.find({e.assembly, e.ns});
         if (it != nsItems_.end())
             target = it->second;
     } else if (e.kind == SearchEntry::Kind::Type) {
@@ -789,16 +1638,16 @@ void MainWindow::navigateToSearchResult(QListWidgetItem* item) {
             }
         }
 
-        if (!target && e.memberIndex >= 0 && e.memberIndex < (int)types_[(size_t)e.typeIndex].members.size()) {
-            const auto& m = types_[(size_t)e.typeIndex].members[(size_t)e.memberIndex];
+        if (!target && e.memberIndex >= 0 && e.memberIndex < (int)dump_.type((size_t)e.typeIndex).memberCount()) {
+            const auto m = dump_.type((size_t)e.typeIndex).member((size_t)e.memberIndex);
 
             const QIcon childIcon =
-                (m.kind == MemberKind::Ctor)     ? icoCtor_ :
-                (m.kind == MemberKind::Method)   ? icoMethod_ :
-                (m.kind == MemberKind::Field)    ? icoField_ :
-                (m.kind == MemberKind::Property) ? icoProperty_ :
-                (m.kind == MemberKind::Event)    ? icoEvent_ :
-                (m.kind == MemberKind::EnumValue)? icoEnumValue_ :
+                (m.kind() == MemberKind::Ctor)     ? icoCtor_ :
+                (m.kind() == MemberKind::Method)   ? icoMethod_ :
+                (m.kind() == MemberKind::Field)    ? icoField_ :
+                (m.kind() == MemberKind::Property) ? icoProperty_ :
+                (m.kind() == MemberKind::Event)    ? icoEvent_ :
+                (m.kind() == MemberKind::EnumValue)? icoEnumValue_ :
                 icoClass_;
 
             if (groupItem->rowCount() == 1) {
@@ -807,17 +1656,17 @@ void MainWindow::navigateToSearchResult(QListWidgetItem* item) {
                     groupItem->removeRow(0);
             }
 
-            const QString display = QString::fromStdString(m.signature);
+            const QString display = viewText(m.signature());
 
-            const QString sig = QString::fromStdString(m.signature);
-            const QString rva = QString("0x%1").arg(QString::number((qulonglong)m.rva, 16));
-            const QString off = QString("0x%1").arg(QString::number((qulonglong)m.offset, 16));
-            const QString va  = QString("0x%1").arg(QString::number((qulonglong)m.va, 16));
+            const QString sig = viewText(m.signature());
+            const QString rva = QString("0x%1").arg(QString::number((qulonglong)m.rva(), 16));
+            const QString off = QString("0x%1").arg(QString::number((qulonglong)m.offset(), 16));
+            const QString va  = QString("0x%1").arg(QString::number((qulonglong)m.va(), 16));
 
             QString detail;
-            if (m.kind == MemberKind::Method || m.kind == MemberKind::Ctor) {
+            if (m.kind() == MemberKind::Method || m.kind() == MemberKind::Ctor) {
                 detail = sig + "\n" + "RVA: " + rva + "  Offset: " + off + "  VA: " + va;
-            } else if (m.kind == MemberKind::Field || m.kind == MemberKind::Property || m.kind == MemberKind::Event) {
+            } else if (m.kind() == MemberKind::Field || m.kind() == MemberKind::Property || m.kind() == MemberKind::Event) {
                 detail = sig + "\n" + "Offset: " + off;
             } else {
                 detail = sig;
@@ -852,6 +1701,139 @@ void MainWindow::navigateToSearchResult(QListWidgetItem* item) {
     tree_->scrollTo(proxyIdx, QAbstractItemView::PositionAtCenter);
 }
 
+// "Type::Method+0x34"; overloads sharing the start address are counted, not listed.
+QString MainWindow::addressSymbol(const AddressIndex::Hit& hit, uint64_t address) const {
+    const auto t = dump_.type(hit.type);
+    QString text = sym(t.name()) + "::" + sym(dump_.member(hit.member).name());
+    if (address > hit.start)
+        text += "+0x" + QString::number(address - hit.start, 16).toUpper();
+    if (hit.aliases)
+        text += QString(" (+%1 more at this address)").arg(hit.aliases);
+    return text;
+}
+
+void MainWindow::goToAddress() {
+    QString text = gotoAddress_->text().trimmed();
+    if (text.startsWith("0x", Qt::CaseInsensitive))
+        text = text.mid(2);
+    bool ok = false;
+    const uint64_t address = text.toULongLong(&ok, 16);
+    if (!ok) {
+        statusBar()->showMessage("Not a hex address: " + gotoAddress_->text(), 3000);
+        return;
+    }
+    if (!addressIndex_) {
+        statusBar()->showMessage("Addresses are available once all members are loaded", 3000);
+        return;
+    }
+
+    const AddressKind kind = (AddressKind)std::max(0, gotoAddressKind_->currentIndex());
+    AddressIndex::Hit hit;
+    if (!addressIndex_->resolve(kind, address, hit)) {
+        statusBar()->showMessage("No method at or below 0x" + QString::number(address, 16).toUpper(), 3000);
+        return;
+    }
+
+    const auto m = dump_.member(hit.member);
+    navigateToTypeOrMember((int)hit.type, (int)(hit.member - dump_.type(hit.type).memberBegin()), m.kind());
+    statusBar()->showMessage("0x" + QString::number(address, 16).toUpper() + " = " + addressSymbol(hit, address), 8000);
+}
+
+void MainWindow::showSymbolicateDialog() {
+    QDialog dlg(this);
+    dlg.setWindowTitle("Symbolicate");
+    dlg.resize(900, 640);
+
+    auto* lay = new QVBoxLayout(&dlg);
+    lay->setContentsMargins(12, 12, 12, 12);
+    lay->setSpacing(8);
+
+    auto* hint = new QLabel("Paste a backtrace, crash log or address list. Every hex address (0x-prefixed, or 8-16 bare "
+                            "hex digits) is annotated with the method containing it.", &dlg);
+    hint->setWordWrap(true);
+    lay->addWidget(hint);
+
+    auto* input = new QPlainTextEdit(&dlg);
+    input->setPlaceholderText("#00 pc 00000000012a3b4c  /data/app/.../libil2cpp.so\nlibil2cpp.so + 0x1a2b3c");
+    input->setLineWrapMode(QPlainTextEdit::NoWrap);
+    lay->addWidget(input, 1);
+
+    auto* optionsRow = new QHBoxLayout();
+    optionsRow->setContentsMargins(0, 0, 0, 0);
+    auto* loadBtn = new QPushButton("Load log...", &dlg);
+    auto* baseEdit = new QLineEdit(&dlg);
+    baseEdit->setPlaceholderText("Image base (hex, optional)");
+    baseEdit->setToolTip("Subtracted from addresses at or above it; smaller addresses are taken as already relative");
+    auto* kindCombo = new QComboBox(&dlg);
+    kindCombo->addItem("RVA");
+    kindCombo->addItem("Offset");
+    kindCombo->addItem("VA");
+    kindCombo->setCurrentIndex(gotoAddressKind_ ? gotoAddressKind_->currentIndex() : 0);
+    auto* resolveBtn = new QPushButton("Resolve", &dlg);
+    optionsRow->addWidget(loadBtn);
+    optionsRow->addWidget(baseEdit, 1);
+    optionsRow->addWidget(kindCombo);
+    optionsRow->addWidget(resolveBtn);
+    lay->addLayout(optionsRow);
+
+    auto* output = new QPlainTextEdit(&dlg);
+    output->setReadOnly(true);
+    output->setLineWrapMode(QPlainTextEdit::NoWrap);
+    lay->addWidget(output, 1);
+
+    auto* btnRow = new QHBoxLayout();
+    btnRow->setContentsMargins(0, 0, 0, 0);
+    auto* countLabel = new QLabel(&dlg);
+    auto* copyBtn = new QPushButton("Copy", &dlg);
+    auto* closeBtn = new QPushButton("Close", &dlg);
+    btnRow->addWidget(countLabel, 1);
+    btnRow->addWidget(copyBtn);
+    btnRow->addWidget(closeBtn);
+    lay->addLayout(btnRow);
+
+    connect(loadBtn, &QPushButton::clicked, &dlg, [&dlg, input]() {
+        const QString path = QFileDialog::getOpenFileName(&dlg, "Load log", QString(), "Logs (*.txt *.log);;All files (*.*)");
+        if (path.isEmpty())
+            return;
+        QFile f(path);
+        if (!f.open(QIODevice::ReadOnly)) {
+            QMessageBox::warning(&dlg, "Load log", "Cannot open " + path);
+            return;
+        }
+        input->setPlainText(QString::fromUtf8(f.readAll()));
+    });
+    connect(resolveBtn, &QPushButton::clicked, &dlg, [this, input, baseEdit, kindCombo, output, countLabel]() {
+        if (!addressIndex_) {
+            countLabel->setText("Addresses are available once all members are loaded");
+            return;
+        }
+        QString baseText = baseEdit->text().trimmed();
+        if (baseText.startsWith("0x", Qt::CaseInsensitive))
+            baseText = baseText.mid(2);
+        bool ok = true;
+        const uint64_t base = baseText.isEmpty() ? 0 : baseText.toULongLong(&ok, 16);
+        if (!ok) {
+            countLabel->setText("Not a hex image base: " + baseEdit->text());
+            return;
+        }
+
+        const QByteArray text = input->toPlainText().toUtf8();
+        const auto result = Symbolicator::annotate(std::string_view(text.constData(), (size_t)text.size()), *addressIndex_,
+                                                   (AddressKind)std::max(0, kindCombo->currentIndex()), base,
+                                                   [this](const AddressIndex::Hit& hit, uint64_t address) {
+                                                       return addressSymbol(hit, address).toStdString();
+                                                   });
+        output->setPlainText(QString::fromUtf8(result.text.data(), (qsizetype)result.text.size()));
+        countLabel->setText(QString("%1 of %2 addresses resolved").arg(result.resolved).arg(result.addresses));
+    });
+    connect(copyBtn, &QPushButton::clicked, &dlg, [this, output]() {
+        copyTextToClipboard(output->toPlainText(), "Copied symbolicated text");
+    });
+    connect(closeBtn, &QPushButton::clicked, &dlg, &QDialog::accept);
+
+    dlg.exec();
+}
+
 class TreeFilterProxy final : public QSortFilterProxyModel {
 public:
     using QSortFilterProxyModel::QSortFilterProxyModel;
@@ -912,15 +1894,27 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent) {
     }
     settings.endGroup();
 
-    watcher_ = new QFutureWatcher<std::vector<DumpType>>(this);
-    connect(watcher_, &QFutureWatcher<std::vector<DumpType>>::finished,
+    watcher_ = new QFutureWatcher<DumpModel>(this);
+    connect(watcher_, &QFutureWatcher<DumpModel>::finished,
             this, &MainWindow::finishParseAsync);
 
+    typeBatchTimer_ = new QTimer(this);
+    typeBatchTimer_->setInterval(100);
+    connect(typeBatchTimer_, &QTimer::timeout, this, &MainWindow::mergeTypeBatches);
+
     restoreUiState();
     refreshRecentUi();
 }
 
 void MainWindow::closeEvent(QCloseEvent* e) {
+    // The workers post back through this window, so none may outlive it; all of them stop at their next cancel check.
+    parseCancel_.cancel();
+    compareCancel_.cancel();
+    fillCancel_.cancel();
+    watcher_->waitForFinished();
+    compareFuture_.waitForFinished();
+    fillFuture_.waitForFinished();
+    cacheSaveFuture_.waitForFinished();
     saveUiState();
     QMainWindow::closeEvent(e);
 }
@@ -961,6 +1955,172 @@ void MainWindow::refreshRecentUi() {
         saveRecentFiles(cleaned);
 }
 
+void MainWindow::refreshAssemblyFilterUi() {
+    if (!assemblyFilterLabel_)
+        return;
+    QStringList include;
+    QStringList exclude;
+    loadAssemblyPatterns(include, exclude);
+
+    QStringList parts;
+    if (!include.isEmpty())
+        parts << "Only: " + include.join(", ");
+    if (!exclude.isEmpty())
+        parts << "Skipping: " + exclude.join(", ");
+    assemblyFilterLabel_->setText(parts.isEmpty() ? "Loading all assemblies" : parts.join("  |  "));
+}
+
+void MainWindow::editAssemblyFilter() {
+    static const QString kFrameworkPatterns = "mscorlib, netstandard, System*, Mono.*, UnityEngine*, Unity.*";
+
+    QStringList include;
+    QStringList exclude;
+    loadAssemblyPatterns(include, exclude);
+
+    QDialog dlg(this);
+    dlg.setWindowTitle("Assemblies to load");
+    dlg.resize(560, 560);
+
+    auto* lay = new QVBoxLayout(&dlg);
+    lay->setContentsMargins(12, 12, 12, 12);
+    lay->setSpacing(8);
+
+    auto* hint = new QLabel("Comma-separated name patterns; * and ? are wildcards and the .dll suffix is optional. "
+                            "Types of assemblies that are not loaded are skipped while parsing.", &dlg);
+    hint->setWordWrap(true);
+    lay->addWidget(hint);
+
+    auto* grid = new QGridLayout();
+    grid->setContentsMargins(0, 0, 0, 0);
+    grid->setSpacing(6);
+    auto* includeEdit = new QLineEdit(include.join(", "), &dlg);
+    includeEdit->setPlaceholderText("All assemblies");
+    auto* excludeEdit = new QLineEdit(exclude.join(", "), &dlg);
+    excludeEdit->setPlaceholderText("None");
+    auto* frameworkBtn = new QPushButton("Skip framework", &dlg);
+    grid->addWidget(new QLabel("Include:", &dlg), 0, 0);
+    grid->addWidget(includeEdit, 0, 1, 1, 2);
+    grid->addWidget(new QLabel("Exclude:", &dlg), 1, 0);
+    grid->addWidget(excludeEdit, 1, 1);
+    grid->addWidget(frameworkBtn, 1, 2);
+    lay->addLayout(grid);
+
+    auto* sourceRow = new QHBoxLayout();
+    sourceRow->setContentsMargins(0, 0, 0, 0);
+    auto* sourceLabel = new QLabel("No dump selected", &dlg);
+    auto* browseBtn = new QPushButton("List from dump...", &dlg);
+    sourceRow->addWidget(sourceLabel, 1);
+    sourceRow->addWidget(browseBtn);
+    lay->addLayout(sourceRow);
+
+    auto* list = new QListWidget(&dlg);
+    lay->addWidget(list, 1);
+    auto* countLabel = new QLabel(&dlg);
+    lay->addWidget(countLabel);
+
+    auto* btnRow = new QHBoxLayout();
+    btnRow->setContentsMargins(0, 0, 0, 0);
+    auto* clearBtn = new QPushButton("Load all", &dlg);
+    auto* cancelBtn = new QPushButton("Cancel", &dlg);
+    auto* saveBtn = new QPushButton("Save", &dlg);
+    btnRow->addWidget(clearBtn);
+    btnRow->addStretch(1);
+    btnRow->addWidget(cancelBtn);
+    btnRow->addWidget(saveBtn);
+    lay->addLayout(btnRow);
+
+    // Checks mirror the patterns; ticking items by hand turns the checked set into an explicit include list.
+    bool syncing = false;
+    int loaded = 0;
+    auto syncChecks = [&]() {
+        const AssemblyFilter filter = makeAssemblyFilter(splitPatterns(includeEdit->text()), splitPatterns(excludeEdit->text()));
+        syncing = true;
+        loaded = 0;
+        for (int i = 0; i < list->count(); ++i) {
+            QListWidgetItem* it = list->item(i);
+            const bool allowed = filter.allows(it->data(Qt::UserRole).toString().toStdString());
+            it->setCheckState(allowed ? Qt::Checked : Qt::Unchecked);
+            loaded += allowed ? 1 : 0;
+        }
+        syncing = false;
+        countLabel->setText(list->count() ? QString("%1 of %2 assemblies will load").arg(loaded).arg(list->count()) : QString());
+    };
+
+    auto listImages = [&](const QString& path) {
+        std::vector<ImageMapEntry> images;
+        try {
+            images = DumpCsParser::readImages(path.toStdString());
+        } catch (const std::exception& ex) {
+            QMessageBox::warning(&dlg, "Assemblies", "Cannot read " + path + ": " + QString::fromUtf8(ex.what()));
+            return;
+        }
+        syncing = true;
+        list->clear();
+        for (size_t i = 0; i < images.size(); ++i) {
+            const QString name = QString::fromStdString(images[i].assembly);
+            QString label = name;
+            if (i + 1 < images.size())
+                label += QString("  (%1 types)").arg(images[i + 1].baseTypeDefIndex - images[i].baseTypeDefIndex);
+            auto* it = new QListWidgetItem(label, list);
+            it->setData(Qt::UserRole, name);
+            it->setFlags(it->flags() | Qt::ItemIsUserCheckable);
+        }
+        sourceLabel->setText(images.empty() ? "No image table in " + QFileInfo(path).fileName()
+                                            : "Assemblies in " + QFileInfo(path).fileName());
+        syncChecks();
+    };
+
+    connect(includeEdit, &QLineEdit::textChanged, &dlg, [&]() { syncChecks(); });
+    connect(excludeEdit, &QLineEdit::textChanged, &dlg, [&]() { syncChecks(); });
+    connect(frameworkBtn, &QPushButton::clicked, &dlg, [&]() { excludeEdit->setText(kFrameworkPatterns); });
+    connect(clearBtn, &QPushButton::clicked, &dlg, [&]() {
+        includeEdit->clear();
+        excludeEdit->clear();
+    });
+    connect(list, &QListWidget::itemChanged, &dlg, [&]() {
+        if (syncing)
+            return;
+        QStringList checked;
+        for (int i = 0; i < list->count(); ++i) {
+            if (list->item(i)->checkState() == Qt::Checked)
+                checked << list->item(i)->data(Qt::UserRole).toString();
+        }
+        {
+            const QSignalBlocker b1(includeEdit);
+            const QSignalBlocker b2(excludeEdit);
+            includeEdit->setText(checked.size() == list->count() ? QString() : checked.join(", "));
+            excludeEdit->clear();
+        }
+        syncChecks();
+    });
+    connect(browseBtn, &QPushButton::clicked, &dlg, [&]() {
+        const QString path = QFileDialog::getOpenFileName(&dlg, "List assemblies from", QString(), "C# dump (*.cs *.cs.gz *.cs.zst)");
+        if (!path.isEmpty())
+            listImages(path);
+    });
+    connect(cancelBtn, &QPushButton::clicked, &dlg, &QDialog::reject);
+    connect(saveBtn, &QPushButton::clicked, &dlg, [&]() {
+        if (list->count() > 0 && loaded == 0) {
+            QMessageBox::warning(&dlg, "Assemblies", "No assembly of this dump would load with these patterns.");
+            return;
+        }
+        saveAssemblyPatterns(splitPatterns(includeEdit->text()), splitPatterns(excludeEdit->text()));
+        dlg.accept();
+    });
+
+    for (const auto& p : loadRecentFiles()) {
+        if (QFileInfo::exists(p)) {
+            listImages(p);
+            break;
+        }
+    }
+
+    if (dlg.exec() == QDialog::Accepted) {
+        refreshAssemblyFilterUi();
+        statusBar()->showMessage("Assembly filter applies from the next load", 3000);
+    }
+}
+
 void MainWindow::restoreUiState() {
     QSettings s = appSettings();
     s.beginGroup("Ui");
@@ -1050,23 +2210,23 @@ void MainWindow::navigateToTypeOrMember(int typeIndex, int memberIndex, MemberKi
 }
 
 QString MainWindow::buildSnippetText(int typeIndex, int memberIndex, const QString& templateName) const {
-    if (typeIndex < 0 || (size_t)typeIndex >= types_.size())
+    if (typeIndex < 0 || (size_t)typeIndex >= dump_.typeCount())
         return {};
-    const auto& t = types_[(size_t)typeIndex];
-    if (memberIndex < 0 || (size_t)memberIndex >= t.members.size())
+    const auto t = dump_.type((size_t)typeIndex);
+    if (memberIndex < 0 || (size_t)memberIndex >= t.memberCount())
         return {};
 
-    const auto& m = t.members[(size_t)memberIndex];
+    const auto m = t.member((size_t)memberIndex);
 
-    const QString clazz = QString::fromStdString(t.name);
-    const QString memberName = bestMemberNameForSnippet(m);
-    const int argc = m.paramCount;
+    const QString clazz = sym(t.name());
+    const QString memberName = bestMemberNameForSnippet(m, sym(m.name()));
+    const int argc = m.paramCount();
 
-    QString assembly = QString::fromStdString(t.assembly);
+    QString assembly = sym(t.assembly());
     if (assembly.isEmpty())
         assembly = "(unknown)";
 
-    QString ns = QString::fromStdString(t.nameSpace);
+    const QString& ns = sym(t.nameSpace());
     const QString nsForSnippet = (ns == "-") ? QString() : ns;
 
     QMap<QString, QString> vars;
@@ -1077,9 +2237,9 @@ QString MainWindow::buildSnippetText(int typeIndex, int memberIndex, const QStri
     vars.insert("${memberName}", memberName);
     vars.insert("${methodName}", memberName);
     vars.insert("${parameterCount}", QString::number(argc));
-    vars.insert("${fieldName}", (m.kind == MemberKind::Field) ? memberName : QString());
-    vars.insert("${propertyName}", (m.kind == MemberKind::Property) ? memberName : QString());
-    vars.insert("${eventName}", (m.kind == MemberKind::Event) ? memberName : QString());
+    vars.insert("${fieldName}", (m.kind() == MemberKind::Field) ? memberName : QString());
+    vars.insert("${propertyName}", (m.kind() == MemberKind::Property) ? memberName : QString());
+    vars.insert("${eventName}", (m.kind() == MemberKind::Event) ? memberName : QString());
 
     QString chosen = templateName;
     if (chosen.isEmpty())
@@ -1089,22 +2249,22 @@ QString MainWindow::buildSnippetText(int typeIndex, int memberIndex, const QStri
 
     QString tpl;
     if (chosen == "BNM") {
-        if (m.kind == MemberKind::Field)
+        if (m.kind() == MemberKind::Field)
             tpl = defaultSnippetTemplateBnmField();
-        else if (m.kind == MemberKind::Property)
+        else if (m.kind() == MemberKind::Property)
             tpl = defaultSnippetTemplateBnmProperty();
-        else if (m.kind == MemberKind::Event)
+        else if (m.kind() == MemberKind::Event)
             tpl = defaultSnippetTemplateBnmEvent();
         else
             tpl = defaultSnippetTemplateBnm();
     } else {
         tpl = snippetTemplates_.value(chosen);
         if (tpl.isEmpty()) {
-            if (m.kind == MemberKind::Field)
+            if (m.kind() == MemberKind::Field)
                 tpl = defaultSnippetTemplateBnmField();
-            else if (m.kind == MemberKind::Property)
+            else if (m.kind() == MemberKind::Property)
                 tpl = defaultSnippetTemplateBnmProperty();
-            else if (m.kind == MemberKind::Event)
+            else if (m.kind() == MemberKind::Event)
                 tpl = defaultSnippetTemplateBnmEvent();
             else
                 tpl = defaultSnippetTemplateBnm();
@@ -1114,6 +2274,30 @@ QString MainWindow::buildSnippetText(int typeIndex, int memberIndex, const QStri
     return applySnippetTemplate(tpl, vars);
 }
 
+QString MainWindow::sourceText(const SourceSpan& span) const {
+    constexpr uint32_t kMaxRawBytes = 1u << 20;
+    if (sourcePath_.isEmpty() || span.length == 0)
+        return {};
+    const QFileInfo info(sourcePath_);
+    if (info.size() != sourceSize_ || info.lastModified().toMSecsSinceEpoch() != sourceMtime_)
+        return {};
+
+    // Mapped per request so the dump is never held open between selections.
+    MappedFile mapped;
+    if (!mapped.open(sourcePath_.toStdString()) || (qint64)mapped.size() != sourceSize_)
+        return {};
+    if (CompressedStream::detect(mapped.view()) != Compression::None)
+        return {};
+    if (span.offset > mapped.size() || span.length > mapped.size() - span.offset)
+        return {};
+
+    const uint32_t n = std::min(span.length, kMaxRawBytes);
+    QString text = QString::fromUtf8(mapped.data() + span.offset, (qsizetype)n);
+    if (n < span.length)
+        text += "\n... (truncated)";
+    return text;
+}
+
 void MainWindow::updateDetailsPanel(const QModelIndex& srcIdx) {
     selectedTypeIndex_ = -1;
     selectedMemberIndex_ = -1;
@@ -1146,11 +2330,11 @@ void MainWindow::updateDetailsPanel(const QModelIndex& srcIdx) {
     QString memberName;
     QString kind;
 
-    if (selectedTypeIndex_ >= 0 && (size_t)selectedTypeIndex_ < types_.size()) {
-        const auto& t = types_[(size_t)selectedTypeIndex_];
-        assembly = QString::fromStdString(t.assembly);
-        ns = QString::fromStdString(t.nameSpace);
-        clazz = QString::fromStdString(t.name);
+    if (selectedTypeIndex_ >= 0 && (size_t)selectedTypeIndex_ < dump_.typeCount()) {
+        const auto t = dump_.type((size_t)selectedTypeIndex_);
+        assembly = sym(t.assembly());
+        ns = sym(t.nameSpace());
+        clazz = sym(t.name());
     }
 
     selectedSignature_ = srcIdx.data(Qt::UserRole + 101).toString();
@@ -1158,12 +2342,12 @@ void MainWindow::updateDetailsPanel(const QModelIndex& srcIdx) {
     selectedVa_ = srcIdx.data(Qt::UserRole + 103).toString();
     selectedRva_ = srcIdx.data(Qt::UserRole + 104).toString();
 
-    if (selectedMemberIndex_ >= 0 && selectedTypeIndex_ >= 0 && (size_t)selectedTypeIndex_ < types_.size()) {
-        const auto& t = types_[(size_t)selectedTypeIndex_];
-        if ((size_t)selectedMemberIndex_ < t.members.size()) {
-            const auto& m = t.members[(size_t)selectedMemberIndex_];
-            memberName = QString::fromStdString(m.name);
-            kind = kindToString(m.kind);
+    if (selectedMemberIndex_ >= 0 && selectedTypeIndex_ >= 0 && (size_t)selectedTypeIndex_ < dump_.typeCount()) {
+        const auto t = dump_.type((size_t)selectedTypeIndex_);
+        if ((size_t)selectedMemberIndex_ < t.memberCount()) {
+            const auto m = t.member((size_t)selectedMemberIndex_);
+            memberName = sym(m.name());
+            kind = kindToString(m.kind());
         }
     }
 
@@ -1181,7 +2365,17 @@ void MainWindow::updateDetailsPanel(const QModelIndex& srcIdx) {
         selectedSnippet_ = buildSnippetText(selectedTypeIndex_, selectedMemberIndex_);
     }
 
-    const QString body = srcIdx.data(Qt::UserRole + 100).toString();
+    // Original dump text when the source is still on disk unchanged; the synthesized detail otherwise.
+    QString body;
+    if (selectedTypeIndex_ >= 0 && (size_t)selectedTypeIndex_ < dump_.typeCount()) {
+        const auto t = dump_.type((size_t)selectedTypeIndex_);
+        if (selectedMemberIndex_ < 0)
+            body = sourceText(t.sourceSpan());
+        else if ((size_t)selectedMemberIndex_ < t.memberCount())
+            body = sourceText(t.member((size_t)selectedMemberIndex_).sourceSpan());
+    }
+    if (body.isEmpty())
+        body = srcIdx.data(Qt::UserRole + 100).toString();
 
     QString summary;
     if (!assembly.isEmpty()) summary += "Assembly: " + assembly + "\n";
@@ -1402,8 +2596,22 @@ QWidget* MainWindow::buildWelcomePage() {
     row->addStretch();
     bodyLay->addLayout(row);
 
+    assemblyFilterLabel_ = new QLabel(body);
+    assemblyFilterLabel_->setWordWrap(true);
+    assemblyFilterLabel_->setMaximumWidth(480);
+    auto* assemblyFilterBtn = new QPushButton("Assemblies...", body);
+
+    auto* filterRow = new QHBoxLayout();
+    filterRow->addStretch();
+    filterRow->addWidget(assemblyFilterLabel_);
+    filterRow->addWidget(assemblyFilterBtn);
+    filterRow->addStretch();
+    bodyLay->addLayout(filterRow);
+    refreshAssemblyFilterUi();
+
     bodyLay->addStretch();
     connect(openBtn_, &QPushButton::clicked, this, &MainWindow::openDumpCs);
+    connect(assemblyFilterBtn, &QPushButton::clicked, this, &MainWindow::editAssemblyFilter);
 
     if (recentList_) {
         connect(recentList_, &QListWidget::itemActivated, this, [this](QListWidgetItem* it) {
@@ -1447,15 +2655,43 @@ QWidget* MainWindow::buildExplorerPage() {
     busyBar_->setRange(0, 100);
     busyBar_->setValue(0);
 
+    busyCancelBtn_ = new QPushButton("Cancel", busyRow_);
+    busyCancelBtn_->setVisible(false);
+    connect(busyCancelBtn_, &QPushButton::clicked, this, [this]() {
+        pendingParsePath_.clear();
+        parseCancel_.cancel();
+        if (busyLabel_) busyLabel_->setText("Cancelling…");
+    });
+
     busyLay->addWidget(busyLabel_);
     busyLay->addWidget(busyBar_, 1);
+    busyLay->addWidget(busyCancelBtn_);
     busyRow_->setVisible(false);
 
     contentLay->addWidget(busyRow_);
 
-    search_ = new QLineEdit(content);
+    auto* searchRow = new QWidget(content);
+    auto* searchLay = new QHBoxLayout(searchRow);
+    searchLay->setContentsMargins(0, 0, 0, 0);
+    searchLay->setSpacing(6);
+
+    search_ = new QLineEdit(searchRow);
     search_->setPlaceholderText("Search (types, methods, fields, properties, enum values)...");
-    contentLay->addWidget(search_);
+
+    gotoAddress_ = new QLineEdit(searchRow);
+    gotoAddress_->setPlaceholderText("Go to address (hex)");
+    gotoAddress_->setToolTip("Find the method or constructor containing an address");
+    gotoAddressKind_ = new QComboBox(searchRow);
+    gotoAddressKind_->addItem("RVA");
+    gotoAddressKind_->addItem("Offset");
+    gotoAddressKind_->addItem("VA");
+
+    searchLay->addWidget(search_, 3);
+    searchLay->addWidget(gotoAddress_, 1);
+    searchLay->addWidget(gotoAddressKind_);
+    symbolicateBtn_ = new QPushButton("Symbolicate...", searchRow);
+    searchLay->addWidget(symbolicateBtn_);
+    contentLay->addWidget(searchRow);
 
     auto* splitter = new QSplitter(content);
     mainSplitter_ = splitter;
@@ -1529,40 +2765,41 @@ QWidget* MainWindow::buildExplorerPage() {
     });
 
     auto exportJson = [this]() {
-        if (selectedTypeIndex_ < 0 || (size_t)selectedTypeIndex_ >= types_.size())
+        if (selectedTypeIndex_ < 0 || (size_t)selectedTypeIndex_ >= dump_.typeCount())
             return;
+        ensureTypeMembers(selectedTypeIndex_);
 
         const QString path = QFileDialog::getSaveFileName(
             this, "Export JSON", {}, "JSON (*.json);;All files (*.*)");
         if (path.isEmpty())
             return;
 
-        const auto& t = types_[(size_t)selectedTypeIndex_];
+        const auto t = dump_.type((size_t)selectedTypeIndex_);
         auto hex = [](qulonglong v) { return QString("0x%1").arg(QString::number(v, 16)); };
 
         QJsonObject typeObj;
-        typeObj["assembly"] = QString::fromStdString(t.assembly);
-        typeObj["namespace"] = QString::fromStdString(t.nameSpace);
-        typeObj["className"] = QString::fromStdString(t.name);
-        typeObj["typeDefIndex"] = t.typeDefIndex;
+        typeObj["assembly"] = sym(t.assembly());
+        typeObj["namespace"] = sym(t.nameSpace());
+        typeObj["className"] = sym(t.name());
+        typeObj["typeDefIndex"] = t.typeDefIndex();
 
-        auto memberToJson = [&](const DumpMember& m) {
+        auto memberToJson = [&](const MemberView& m) {
             QJsonObject o;
-            o["kind"] = kindToString(m.kind);
-            o["name"] = QString::fromStdString(m.name);
-            o["signature"] = QString::fromStdString(m.signature);
-            o["rva"] = hex((qulonglong)m.rva);
-            o["offset"] = hex((qulonglong)m.offset);
-            o["va"] = hex((qulonglong)m.va);
+            o["kind"] = kindToString(m.kind());
+            o["name"] = sym(m.name());
+            o["signature"] = viewText(m.signature());
+            o["rva"] = hex((qulonglong)m.rva());
+            o["offset"] = hex((qulonglong)m.offset());
+            o["va"] = hex((qulonglong)m.va());
             return o;
         };
 
-        if (selectedMemberIndex_ >= 0 && (size_t)selectedMemberIndex_ < t.members.size()) {
-            const auto& m = t.members[(size_t)selectedMemberIndex_];
+        if (selectedMemberIndex_ >= 0 && (size_t)selectedMemberIndex_ < t.memberCount()) {
+            const auto m = t.member((size_t)selectedMemberIndex_);
             typeObj.insert("member", QJsonValue(memberToJson(m)));
         } else {
             QJsonArray arr;
-            for (const auto& m : t.members)
+            for (const auto m : t.members())
                 arr.push_back(memberToJson(m));
             typeObj.insert("members", QJsonValue(arr));
         }
@@ -1580,15 +2817,16 @@ QWidget* MainWindow::buildExplorerPage() {
     };
 
     auto exportCsv = [this]() {
-        if (selectedTypeIndex_ < 0 || (size_t)selectedTypeIndex_ >= types_.size())
+        if (selectedTypeIndex_ < 0 || (size_t)selectedTypeIndex_ >= dump_.typeCount())
             return;
+        ensureTypeMembers(selectedTypeIndex_);
 
         const QString path = QFileDialog::getSaveFileName(
             this, "Export CSV", {}, "CSV (*.csv);;All files (*.*)");
         if (path.isEmpty())
             return;
 
-        const auto& t = types_[(size_t)selectedTypeIndex_];
+        const auto t = dump_.type((size_t)selectedTypeIndex_);
         auto hex = [](qulonglong v) { return QString("0x%1").arg(QString::number(v, 16)); };
         auto esc = [](QString s) {
             s.replace('"', "\"\"");
@@ -1601,25 +2839,25 @@ QWidget* MainWindow::buildExplorerPage() {
         QTextStream out(&f);
         out << "assembly,namespace,className,typeDefIndex,memberKind,memberName,signature,rva,offset,va\n";
 
-        auto writeMember = [&](const DumpMember& m) {
+        auto writeMember = [&](const MemberView& m) {
             out
-                << esc(QString::fromStdString(t.assembly)) << ','
-                << esc(QString::fromStdString(t.nameSpace)) << ','
-                << esc(QString::fromStdString(t.name)) << ','
-                << t.typeDefIndex << ','
-                << esc(kindToString(m.kind)) << ','
-                << esc(QString::fromStdString(m.name)) << ','
-                << esc(QString::fromStdString(m.signature)) << ','
-                << esc(hex((qulonglong)m.rva)) << ','
-                << esc(hex((qulonglong)m.offset)) << ','
-                << esc(hex((qulonglong)m.va))
+                << esc(sym(t.assembly())) << ','
+                << esc(sym(t.nameSpace())) << ','
+                << esc(sym(t.name())) << ','
+                << t.typeDefIndex() << ','
+                << esc(kindToString(m.kind())) << ','
+                << esc(sym(m.name())) << ','
+                << esc(viewText(m.signature())) << ','
+                << esc(hex((qulonglong)m.rva())) << ','
+                << esc(hex((qulonglong)m.offset())) << ','
+                << esc(hex((qulonglong)m.va()))
                 << "\n";
         };
 
-        if (selectedMemberIndex_ >= 0 && (size_t)selectedMemberIndex_ < t.members.size()) {
-            writeMember(t.members[(size_t)selectedMemberIndex_]);
+        if (selectedMemberIndex_ >= 0 && (size_t)selectedMemberIndex_ < t.memberCount()) {
+            writeMember(t.member((size_t)selectedMemberIndex_));
         } else {
-            for (const auto& m : t.members)
+            for (const auto m : t.members())
                 writeMember(m);
         }
 
@@ -1691,7 +2929,11 @@ QWidget* MainWindow::buildExplorerPage() {
     resultsScope_->addItem("Selected Type");
     resultsScope_->setCurrentIndex(0);
 
+    resultsFuzzy_ = new QCheckBox("Fuzzy", resultsCard);
+    resultsFuzzy_->setToolTip("Rank names by subsequence match, e.g. GPCtrl finds GetPlayerController");
+
     resultsSearchRow->addWidget(resultsSearch_, 1);
+    resultsSearchRow->addWidget(resultsFuzzy_);
     resultsSearchRow->addWidget(resultsScope_);
     resultsLay->addLayout(resultsSearchRow);
 
@@ -1731,7 +2973,7 @@ QWidget* MainWindow::buildExplorerPage() {
 
     resultsList_ = new QListWidget(resultsCard);
     resultsList_->setUniformItemSizes(true);
-    resultsList_->setItemDelegate(new ResultsQueryHighlightDelegate(resultsSearch_, resultsList_));
+    resultsList_->setItemDelegate(new ResultsQueryHighlightDelegate(resultsSearch_, resultsFuzzy_, resultsList_));
     resultsLay->addWidget(resultsList_, 1);
 
     model_ = new QStandardItemModel(this);
@@ -1789,6 +3031,8 @@ void MainWindow::setupInteractions() {
         if (!text.isEmpty())
             tree_->expandToDepth(2);
     });
+    connect(gotoAddress_, &QLineEdit::returnPressed, this, [this]() { goToAddress(); });
+    connect(symbolicateBtn_, &QPushButton::clicked, this, [this]() { showSymbolicateDialog(); });
 
     if (!resultsFilterTimer_) {
         resultsFilterTimer_ = new QTimer(this);
@@ -1825,14 +3069,14 @@ void MainWindow::setupInteractions() {
             const MemberKind mk = (MemberKind)item->data(Qt::UserRole + 6).toInt();
 
             QStandardItem* target = nullptr;
+            SymbolId asmId = StringPool::kEmpty;
+            SymbolId nsId = StringPool::kEmpty;
             if (kind == 0) {
-                const std::string key = asmName.toStdString();
-                auto it = asmItems_.find(key);
+                auto it = findSymbol(asmName, asmId) ? asmItems_.find(asmId) : asmItems_.end();
                 if (it != asmItems_.end())
                     target = it->second;
             } else if (kind == 1) {
-                const std::string key = asmName.toStdString() + "|" + nsName.toStdString();
-                auto it = nsItems_.find(key);
+                auto it = (findSymbol(asmName, asmId) && findSymbol(nsName, nsId)) ? nsItems_.find({asmId, nsId}) : nsItems_.end();
                 if (it != nsItems_.end())
                     target = it->second;
             } else if (kind == 2) {
@@ -1910,6 +3154,7 @@ void MainWindow::setupInteractions() {
     auto connectFilter = [this](QCheckBox* cb) {
         connect(cb, &QCheckBox::toggled, this, [this](bool) { updateSearchResults(); });
     };
+    connectFilter(resultsFuzzy_);
     connectFilter(filterNs_);
     connectFilter(filterType_);
     connectFilter(filterMethod_);
@@ -1959,10 +3204,10 @@ void MainWindow::showContextMenu(const QPoint& p) {
     QString asmName;
     QString nsName;
     if (hasMemberIndex || isType) {
-        if (typeIndex >= 0 && (size_t)typeIndex < types_.size()) {
-            const auto& t = types_[(size_t)typeIndex];
-            asmName = QString::fromStdString(t.assembly.empty() ? std::string("(unknown)") : t.assembly);
-            nsName = QString::fromStdString(t.nameSpace);
+        if (typeIndex >= 0 && (size_t)typeIndex < dump_.typeCount()) {
+            const auto t = dump_.type((size_t)typeIndex);
+            asmName = t.assembly() == StringPool::kEmpty ? QString("(unknown)") : sym(t.assembly());
+            nsName = sym(t.nameSpace());
         }
     } else {
         const QString parentAsm = srcIdx.parent().data(Qt::UserRole + 100).toString();
@@ -1980,17 +3225,17 @@ void MainWindow::showContextMenu(const QPoint& p) {
     if (hasMemberIndex) {
         favKind = 3;
         favKey = QString("mem|%1|%2|%3").arg(typeIndex).arg(memberIndex).arg(memberKind);
-        if (typeIndex >= 0 && (size_t)typeIndex < types_.size() && memberIndex >= 0 && (size_t)memberIndex < types_[(size_t)typeIndex].members.size()) {
-            const auto& t = types_[(size_t)typeIndex];
-            const auto& m = t.members[(size_t)memberIndex];
-            favDisplay = QString::fromStdString(t.assembly + " :: " + t.nameSpace + "::" + t.name + "  " + m.signature);
+        if (typeIndex >= 0 && (size_t)typeIndex < dump_.typeCount() && memberIndex >= 0 && (size_t)memberIndex < dump_.type((size_t)typeIndex).memberCount()) {
+            const auto t = dump_.type((size_t)typeIndex);
+            const auto m = t.member((size_t)memberIndex);
+            favDisplay = sym(t.assembly()) + " :: " + sym(t.nameSpace()) + "::" + sym(t.name()) + "  " + viewText(m.signature());
         }
     } else if (isType) {
         favKind = 2;
         favKey = QString("type|%1").arg(typeIndex);
-        if (typeIndex >= 0 && (size_t)typeIndex < types_.size()) {
-            const auto& t = types_[(size_t)typeIndex];
-            favDisplay = QString::fromStdString(t.assembly + " :: " + t.nameSpace + "::" + t.name);
+        if (typeIndex >= 0 && (size_t)typeIndex < dump_.typeCount()) {
+            const auto t = dump_.type((size_t)typeIndex);
+            favDisplay = sym(t.assembly()) + " :: " + sym(t.nameSpace()) + "::" + sym(t.name());
         }
     } else if (!asmName.isEmpty() && !nsName.isEmpty() && !isGroup && srcIdx.parent().isValid()) {
         favKind = 1;
@@ -2089,26 +3334,26 @@ void MainWindow::showContextMenu(const QPoint& p) {
 }
 
 void MainWindow::showSnippetDialog(int typeIndex, int memberIndex, const QString& templateName) {
-    if (typeIndex < 0 || (size_t)typeIndex >= types_.size())
+    if (typeIndex < 0 || (size_t)typeIndex >= dump_.typeCount())
         return;
-    const auto& t = types_[(size_t)typeIndex];
-    if (memberIndex < 0 || (size_t)memberIndex >= t.members.size())
+    const auto t = dump_.type((size_t)typeIndex);
+    if (memberIndex < 0 || (size_t)memberIndex >= t.memberCount())
         return;
 
-    const auto& m = t.members[(size_t)memberIndex];
-    if (!(m.kind == MemberKind::Method || m.kind == MemberKind::Ctor || m.kind == MemberKind::Field ||
-          m.kind == MemberKind::Property || m.kind == MemberKind::Event))
+    const auto m = t.member((size_t)memberIndex);
+    if (!(m.kind() == MemberKind::Method || m.kind() == MemberKind::Ctor || m.kind() == MemberKind::Field ||
+          m.kind() == MemberKind::Property || m.kind() == MemberKind::Event))
         return;
 
-    const QString clazz = QString::fromStdString(t.name);
-    const QString memberName = bestMemberNameForSnippet(m);
-    const int argc = m.paramCount;
+    const QString clazz = sym(t.name());
+    const QString memberName = bestMemberNameForSnippet(m, sym(m.name()));
+    const int argc = m.paramCount();
 
-    QString assembly = QString::fromStdString(t.assembly);
+    QString assembly = sym(t.assembly());
     if (assembly.isEmpty())
         assembly = "(unknown)";
 
-    QString ns = QString::fromStdString(t.nameSpace);
+    const QString& ns = sym(t.nameSpace());
     const QString nsForSnippet = (ns == "-") ? QString() : ns;
 
     QMap<QString, QString> vars;
@@ -2119,9 +3364,9 @@ void MainWindow::showSnippetDialog(int typeIndex, int memberIndex, const QString
     vars.insert("${memberName}", memberName);
     vars.insert("${methodName}", memberName);
     vars.insert("${parameterCount}", QString::number(argc));
-    vars.insert("${fieldName}", (m.kind == MemberKind::Field) ? memberName : QString());
-    vars.insert("${propertyName}", (m.kind == MemberKind::Property) ? memberName : QString());
-    vars.insert("${eventName}", (m.kind == MemberKind::Event) ? memberName : QString());
+    vars.insert("${fieldName}", (m.kind() == MemberKind::Field) ? memberName : QString());
+    vars.insert("${propertyName}", (m.kind() == MemberKind::Property) ? memberName : QString());
+    vars.insert("${eventName}", (m.kind() == MemberKind::Event) ? memberName : QString());
 
     QString currentTemplateName = templateName;
     if (currentTemplateName.isEmpty())
@@ -2129,7 +3374,7 @@ void MainWindow::showSnippetDialog(int typeIndex, int memberIndex, const QString
     if (currentTemplateName.isEmpty() || !snippetTemplates_.contains(currentTemplateName))
         currentTemplateName = snippetTemplates_.isEmpty() ? QString() : snippetTemplates_.firstKey();
 
-    auto buildSnippet = [this, vars, kind = m.kind](const QString& tplName) {
+    auto buildSnippet = [this, vars, kind = m.kind()](const QString& tplName) {
         QString tpl;
         if (tplName == "BNM") {
             if (kind == MemberKind::Field)
@@ -2566,6 +3811,8 @@ void MainWindow::setBusy(bool busy, const QString& msg) {
     if (openBtn_) openBtn_->setEnabled(!busy);
     if (compareBtn_) compareBtn_->setEnabled(!busy && hasLoadedPrimary_);
     if (search_) search_->setEnabled(!busy);
+    if (gotoAddress_) gotoAddress_->setEnabled(!busy);
+    if (symbolicateBtn_) symbolicateBtn_->setEnabled(!busy);
     if (tree_) tree_->setEnabled(!busy);
     if (busy)
         statusBar()->showMessage(msg.isEmpty() ? "Parsing…" : msg);
@@ -2573,7 +3820,7 @@ void MainWindow::setBusy(bool busy, const QString& msg) {
 
 void MainWindow::openDumpCs() {
     const QString path = QFileDialog::getOpenFileName(
-        this, "Open dump.cs", {}, "C# dump (*.cs);;All files (*.*)");
+        this, "Open dump.cs", {}, "C# dump (*.cs *.cs.gz *.cs.zst);;All files (*.*)");
     if (path.isEmpty()) return;
 
     startParseAsync(path);
@@ -2584,612 +3831,741 @@ void MainWindow::compareDumpCs() {
         return;
 
     const QString path = QFileDialog::getOpenFileName(
-        this, "Compare to dump.cs", {}, "C# dump (*.cs);;All files (*.*)");
+        this, "Compare to dump.cs", {}, "C# dump (*.cs *.cs.gz *.cs.zst);;All files (*.*)");
     if (path.isEmpty())
         return;
 
-    const auto baseTypes = types_;
+    // The comparison needs every member of the loaded dump; a skeleton without a source will never get them.
+    if (dump_.isSkeleton() && !bodySource_) {
+        statusBar()->showMessage("Members of " + parsePath_ + " are unavailable, so it cannot be compared", 6000);
+        return;
+    }
     const QString basePath = parsePath_;
 
     setBusy(true, "Comparing: " + basePath + "  vs  " + path);
 
-    auto* cmpWatcher = new QFutureWatcher<std::vector<DumpType>>(this);
-    connect(cmpWatcher, &QFutureWatcher<std::vector<DumpType>>::finished, this, [this, cmpWatcher, baseTypes, basePath, path]() {
-        const auto newTypes = cmpWatcher->result();
+    auto* cmpWatcher = new QFutureWatcher<DumpModel>(this);
+    connect(cmpWatcher, &QFutureWatcher<DumpModel>::finished, this, [this, cmpWatcher, basePath, path]() {
+        auto pending = std::make_shared<PendingCompare>(PendingCompare{cmpWatcher->result(), path});
         cmpWatcher->deleteLater();
+        if (parsePath_ != basePath) {
+            setBusy(false);
+            return;
+        }
+        // A skeleton is compared once the background member fill completes (afterMembersAdopted).
+        if (dump_.isSkeleton()) {
+            if (busyLabel_) busyLabel_->setText("Comparing: waiting for the members of " + basePath);
+            pendingCompare_ = std::move(pending);
+            return;
+        }
+        finishCompare(pending->other, pending->path);
+    });
 
-        struct Entry {
-            QString exactKey;
-            QString looseKey;
-            QString assembly;
-            QString typeFqn;
-            MemberKind kind = MemberKind::Method;
-            QString name;
-            int paramCount = 0;
-            QString signature;
-            QString sigKey;
-            quint64 offset = 0;
-            quint64 rva = 0;
-            quint64 va = 0;
-        };
+    compareCancel_ = CancellationToken{};
+    ParseOptions options;
+    options.progress = [this](int pct) { postBusyProgress(pct); };
+    options.cancel = compareCancel_;
+    // Same assemblies as the primary dump, so skipped ones do not show up as removed or added.
+    options.assemblies = loadAssemblyFilter();
 
-        struct Maps {
-            QHash<QString, Entry> exact;
-            QMultiHash<QString, QString> looseToExact;
-        };
+    auto future = QtConcurrent::run([path, cacheDir = modelCacheDir(), options, helper = parseHelperPath()]() {
+        try {
+            return parseWithCache(path, cacheDir, nullptr, options, helper);
+        } catch (const std::exception&) {
+            return DumpModel{};
+        }
+    });
+    cmpWatcher->setFuture(future);
+    compareFuture_ = QFuture<void>(future);
+}
 
-        const auto buildMaps = [](const std::vector<DumpType>& types) {
-            Maps out;
-            for (int ti = 0; ti < (int)types.size(); ++ti) {
-                const auto& t = types[(size_t)ti];
-                const QString asmName = QString::fromStdString(t.assembly.empty() ? std::string("(unknown)") : t.assembly);
-                const QString typeFqn = QString::fromStdString(t.nameSpace + "::" + t.name);
-                for (int mi = 0; mi < (int)t.members.size(); ++mi) {
-                    const auto& m = t.members[(size_t)mi];
-                    Entry e;
-                    e.assembly = asmName;
-                    e.typeFqn = typeFqn;
-                    e.kind = m.kind;
-                    e.name = QString::fromStdString(m.name);
-                    e.paramCount = m.paramCount;
-                    e.signature = QString::fromStdString(m.signature);
-                    e.sigKey = normalizeSignature(m);
-                    e.offset = (quint64)m.offset;
-                    e.rva = (quint64)m.rva;
-                    e.va = (quint64)m.va;
-                    e.exactKey = asmName + "|" + typeFqn + "|" + kindToString(m.kind) + "|" + e.sigKey;
-                    e.looseKey = asmName + "|" + typeFqn + "|" + kindToString(m.kind) + "|" + e.name + "|" + QString::number(e.paramCount);
-
-                    out.exact.insert(e.exactKey, e);
-                    out.looseToExact.insert(e.looseKey, e.exactKey);
-                }
-            }
-            return out;
-        };
+// Compares the loaded dump, with all members present, to newModel.
+void MainWindow::finishCompare(const DumpModel& newModel, const QString& path) {
+    const DumpModel& baseModel = dump_;
+    const QString basePath = parsePath_;
+    if (newModel.empty()) {
+        setBusy(false);
+        statusBar()->showMessage("Failed to load: " + path, 4000);
+        return;
+    }
 
-        const auto oldMaps = buildMaps(baseTypes);
-        const auto newMaps = buildMaps(newTypes);
+    struct Entry {
+        QString exactKey;
+        QString looseKey;
+        QString assembly;
+        QString typeFqn;
+        MemberKind kind = MemberKind::Method;
+        QString name;
+        int paramCount = 0;
+        QString signature;
+        QString sigKey;
+        quint64 offset = 0;
+        quint64 rva = 0;
+        quint64 va = 0;
+    };
 
-        auto hex = [](qulonglong v) { return QString("0x%1").arg(QString::number(v, 16)); };
+    struct Maps {
+        QHash<QString, Entry> exact;
+        QMultiHash<QString, QString> looseToExact;
+    };
 
-        auto anyNonZeroOffset = [](const std::vector<DumpType>& types) {
-            for (const auto& t : types) {
-                for (const auto& m : t.members) {
-                    if (m.offset != 0)
-                        return true;
-                }
+    const auto buildMaps = [](const DumpModel& model) {
+        Maps out;
+        std::vector<QString> names(model.strings.size());
+        std::vector<bool> named(model.strings.size(), false);
+        auto text = [&](SymbolId id) -> const QString& {
+            if (!named[id]) {
+                names[id] = symbolText(model, id);
+                named[id] = true;
             }
-            return false;
+            return names[id];
         };
 
-        const bool baseHasOffsets = anyNonZeroOffset(baseTypes);
-        const bool newHasOffsets = anyNonZeroOffset(newTypes);
-        const bool showRvaVaCols = !(baseHasOffsets && newHasOffsets);
-
-        struct Row {
-            QString status;
-            QString assembly;
-            QString typeFqn;
-            MemberKind kind = MemberKind::Method;
-            QString item;
-            QString oldOff, newOff;
-            QString oldRva, newRva;
-            QString oldVa, newVa;
-            QString oldSig, newSig;
-        };
+        for (int ti = 0; ti < (int)model.typeCount(); ++ti) {
+            const auto t = model.type((size_t)ti);
+            const QString asmName = t.assembly() == StringPool::kEmpty ? QString("(unknown)") : text(t.assembly());
+            const QString typeFqn = text(t.nameSpace()) + "::" + text(t.name());
+            for (int mi = 0; mi < (int)t.memberCount(); ++mi) {
+                const auto m = t.member((size_t)mi);
+                Entry e;
+                e.assembly = asmName;
+                e.typeFqn = typeFqn;
+                e.kind = m.kind();
+                e.name = text(m.name());
+                e.paramCount = m.paramCount();
+                e.signature = viewText(m.signature());
+                e.sigKey = normalizeSignature(m, e.name);
+                e.offset = (quint64)m.offset();
+                e.rva = (quint64)m.rva();
+                e.va = (quint64)m.va();
+                e.exactKey = asmName + "|" + typeFqn + "|" + kindToString(m.kind()) + "|" + e.sigKey;
+                e.looseKey = asmName + "|" + typeFqn + "|" + kindToString(m.kind()) + "|" + e.name + "|" + QString::number(e.paramCount);
+
+                out.exact.insert(e.exactKey, e);
+                out.looseToExact.insert(e.looseKey, e.exactKey);
+            }
+        }
+        return out;
+    };
 
-        QVector<Row> rows;
-        rows.reserve(oldMaps.exact.size() + newMaps.exact.size());
+    const auto oldMaps = buildMaps(baseModel);
+    const auto newMaps = buildMaps(newModel);
 
-        QSet<QString> pairedNewExact;
+    auto hex = [](qulonglong v) { return QString("0x%1").arg(QString::number(v, 16)); };
 
-        int changed = 0, added = 0, removed = 0, sigChanged = 0;
+    auto anyNonZeroOffset = [](const DumpModel& model) {
+        return std::any_of(model.memberOffsets.begin(), model.memberOffsets.end(), [](uint64_t off) { return off != 0; });
+    };
 
-        for (auto it = oldMaps.exact.begin(); it != oldMaps.exact.end(); ++it) {
-            const auto jt = newMaps.exact.find(it.key());
-            if (jt != newMaps.exact.end()) {
-                const bool offDiff = jt.value().offset != it.value().offset;
-                const bool rvaDiff = jt.value().rva != it.value().rva;
-                const bool vaDiff  = jt.value().va  != it.value().va;
+    const bool baseHasOffsets = anyNonZeroOffset(baseModel);
+    const bool newHasOffsets = anyNonZeroOffset(newModel);
+    const bool showRvaVaCols = !(baseHasOffsets && newHasOffsets);
+
+    struct Row {
+        QString status;
+        QString assembly;
+        QString typeFqn;
+        MemberKind kind = MemberKind::Method;
+        QString item;
+        QString oldOff, newOff;
+        QString oldRva, newRva;
+        QString oldVa, newVa;
+        QString oldSig, newSig;
+    };
 
-                const bool haveOldOff = (it.value().offset != 0);
-                const bool haveNewOff = (jt.value().offset != 0);
-                const bool haveBothOff = haveOldOff && haveNewOff;
+    QVector<Row> rows;
+    rows.reserve(oldMaps.exact.size() + newMaps.exact.size());
 
-                bool isChanged = false;
-                if (haveBothOff) {
-                    isChanged = offDiff;
-                } else {
-                    isChanged = offDiff || rvaDiff || vaDiff;
-                }
+    QSet<QString> pairedNewExact;
 
-                if (isChanged) {
-                    ++changed;
-                    Row r;
-                    r.status = "Changed";
-                    r.assembly = it.value().assembly;
-                    r.typeFqn = it.value().typeFqn;
-                    r.kind = it.value().kind;
-                    r.item = kindToString(it.value().kind) + "  " + it.value().signature;
-                    r.oldOff = hex(it.value().offset);
-                    r.newOff = hex(jt.value().offset);
-                    r.oldRva = hex(it.value().rva);
-                    r.newRva = hex(jt.value().rva);
-                    r.oldVa  = hex(it.value().va);
-                    r.newVa  = hex(jt.value().va);
-                    rows.push_back(r);
-                }
+    int changed = 0, added = 0, removed = 0, sigChanged = 0;
+
+    for (auto it = oldMaps.exact.begin(); it != oldMaps.exact.end(); ++it) {
+        const auto jt = newMaps.exact.find(it.key());
+        if (jt != newMaps.exact.end()) {
+            const bool offDiff = jt.value().offset != it.value().offset;
+            const bool rvaDiff = jt.value().rva != it.value().rva;
+            const bool vaDiff  = jt.value().va  != it.value().va;
+
+            const bool haveOldOff = (it.value().offset != 0);
+            const bool haveNewOff = (jt.value().offset != 0);
+            const bool haveBothOff = haveOldOff && haveNewOff;
+
+            bool isChanged = false;
+            if (haveBothOff) {
+                isChanged = offDiff;
+            } else {
+                isChanged = offDiff || rvaDiff || vaDiff;
             }
-        }
 
-        for (auto it = oldMaps.exact.begin(); it != oldMaps.exact.end(); ++it) {
-            if (newMaps.exact.contains(it.key()))
-                continue;
+            if (isChanged) {
+                ++changed;
+                Row r;
+                r.status = "Changed";
+                r.assembly = it.value().assembly;
+                r.typeFqn = it.value().typeFqn;
+                r.kind = it.value().kind;
+                r.item = kindToString(it.value().kind) + "  " + it.value().signature;
+                r.oldOff = hex(it.value().offset);
+                r.newOff = hex(jt.value().offset);
+                r.oldRva = hex(it.value().rva);
+                r.newRva = hex(jt.value().rva);
+                r.oldVa  = hex(it.value().va);
+                r.newVa  = hex(jt.value().va);
+                rows.push_back(r);
+            }
+        }
+    }
 
-            const Entry& oldE = it.value();
-            if (oldE.signature.isEmpty())
-                continue;
+    for (auto it = oldMaps.exact.begin(); it != oldMaps.exact.end(); ++it) {
+        if (newMaps.exact.contains(it.key()))
+            continue;
 
-            if (oldE.kind == MemberKind::Method || oldE.kind == MemberKind::Ctor) {
-                const auto candidates = newMaps.looseToExact.values(oldE.looseKey);
-                QString best;
-                for (const auto& candKey : candidates) {
-                    if (oldMaps.exact.contains(candKey))
-                        continue;
-                    if (pairedNewExact.contains(candKey))
-                        continue;
-                    const auto candIt = newMaps.exact.find(candKey);
-                    if (candIt == newMaps.exact.end())
-                        continue;
-                    if (candIt.value().sigKey == oldE.sigKey)
-                        continue;
-                    best = candKey;
-                    break;
-                }
+        const Entry& oldE = it.value();
+        if (oldE.signature.isEmpty())
+            continue;
 
-                if (!best.isEmpty()) {
-                    const Entry& newE = newMaps.exact.value(best);
-                    pairedNewExact.insert(best);
-                    ++sigChanged;
-
-                    Row r;
-                    r.status = "Sig Changed";
-                    r.assembly = oldE.assembly;
-                    r.typeFqn = oldE.typeFqn;
-                    r.kind = oldE.kind;
-                    r.item = kindToString(oldE.kind) + "  " + oldE.name;
-                    r.oldOff = hex(oldE.offset);
-                    r.newOff = hex(newE.offset);
-                    r.oldRva = hex(oldE.rva);
-                    r.newRva = hex(newE.rva);
-                    r.oldVa  = hex(oldE.va);
-                    r.newVa  = hex(newE.va);
-                    r.oldSig = oldE.signature;
-                    r.newSig = newE.signature;
-                    rows.push_back(r);
+        if (oldE.kind == MemberKind::Method || oldE.kind == MemberKind::Ctor) {
+            const auto candidates = newMaps.looseToExact.values(oldE.looseKey);
+            QString best;
+            for (const auto& candKey : candidates) {
+                if (oldMaps.exact.contains(candKey))
                     continue;
-                }
+                if (pairedNewExact.contains(candKey))
+                    continue;
+                const auto candIt = newMaps.exact.find(candKey);
+                if (candIt == newMaps.exact.end())
+                    continue;
+                if (candIt.value().sigKey == oldE.sigKey)
+                    continue;
+                best = candKey;
+                break;
             }
 
-            ++removed;
-            Row r;
-            r.status = "Removed";
-            r.assembly = oldE.assembly;
-            r.typeFqn = oldE.typeFqn;
-            r.kind = oldE.kind;
-            r.item = kindToString(oldE.kind) + "  " + oldE.signature;
-            r.oldOff = hex(oldE.offset);
-            r.oldRva = hex(oldE.rva);
-            r.oldVa  = hex(oldE.va);
-            rows.push_back(r);
-        }
-
-        for (auto it = newMaps.exact.begin(); it != newMaps.exact.end(); ++it) {
-            if (oldMaps.exact.contains(it.key()))
-                continue;
-            if (pairedNewExact.contains(it.key()))
+            if (!best.isEmpty()) {
+                const Entry& newE = newMaps.exact.value(best);
+                pairedNewExact.insert(best);
+                ++sigChanged;
+
+                Row r;
+                r.status = "Sig Changed";
+                r.assembly = oldE.assembly;
+                r.typeFqn = oldE.typeFqn;
+                r.kind = oldE.kind;
+                r.item = kindToString(oldE.kind) + "  " + oldE.name;
+                r.oldOff = hex(oldE.offset);
+                r.newOff = hex(newE.offset);
+                r.oldRva = hex(oldE.rva);
+                r.newRva = hex(newE.rva);
+                r.oldVa  = hex(oldE.va);
+                r.newVa  = hex(newE.va);
+                r.oldSig = oldE.signature;
+                r.newSig = newE.signature;
+                rows.push_back(r);
                 continue;
-            ++added;
-            const Entry& newE = it.value();
-            Row r;
-            r.status = "Added";
-            r.assembly = newE.assembly;
-            r.typeFqn = newE.typeFqn;
-            r.kind = newE.kind;
-            r.item = kindToString(newE.kind) + "  " + newE.signature;
-            r.newOff = hex(newE.offset);
-            r.newRva = hex(newE.rva);
-            r.newVa  = hex(newE.va);
-            rows.push_back(r);
-        }
-
-        auto* dlg = new QDialog(this);
-        dlg->setAttribute(Qt::WA_DeleteOnClose);
-        dlg->setWindowTitle(QString("Diff (%1 changed, %2 added, %3 removed, %4 sig)").arg(changed).arg(added).arg(removed).arg(sigChanged));
-        dlg->resize(980, 640);
-
-        auto* lay = new QVBoxLayout(dlg);
-        lay->setContentsMargins(12, 12, 12, 12);
-        lay->setSpacing(8);
-
-        auto* filter = new QLineEdit(dlg);
-        filter->setPlaceholderText("Filter diff...");
-        lay->addWidget(filter);
-
-        auto* statusRow = new QHBoxLayout();
-        statusRow->setContentsMargins(0, 0, 0, 0);
-        statusRow->setSpacing(10);
-
-        auto* cbAdded = new QCheckBox("Added", dlg);
-        auto* cbChanged = new QCheckBox("Changed", dlg);
-        auto* cbRemoved = new QCheckBox("Removed", dlg);
-        auto* cbSig = new QCheckBox("Sig Changed", dlg);
-        cbAdded->setChecked(true);
-        cbChanged->setChecked(true);
-        cbRemoved->setChecked(true);
-        cbSig->setChecked(true);
-
-        statusRow->addWidget(cbAdded);
-        statusRow->addWidget(cbChanged);
-        statusRow->addWidget(cbRemoved);
-        statusRow->addWidget(cbSig);
-        statusRow->addStretch(1);
-
-        auto* exportJsonBtn = new QPushButton("Export JSON", dlg);
-        auto* exportCsvBtn  = new QPushButton("Export CSV", dlg);
-        statusRow->addWidget(exportJsonBtn);
-        statusRow->addWidget(exportCsvBtn);
-        lay->addLayout(statusRow);
-
-        class DiffFilterProxy final : public QSortFilterProxyModel {
-        public:
-            explicit DiffFilterProxy(QObject* parent = nullptr)
-                : QSortFilterProxyModel(parent) {}
-
-            QSet<QString> allowedStatuses;
-            QString text;
-
-        protected:
-            bool filterAcceptsRow(int source_row, const QModelIndex& source_parent) const override {
-                if (!sourceModel())
-                    return true;
+            }
+        }
+
+        ++removed;
+        Row r;
+        r.status = "Removed";
+        r.assembly = oldE.assembly;
+        r.typeFqn = oldE.typeFqn;
+        r.kind = oldE.kind;
+        r.item = kindToString(oldE.kind) + "  " + oldE.signature;
+        r.oldOff = hex(oldE.offset);
+        r.oldRva = hex(oldE.rva);
+        r.oldVa  = hex(oldE.va);
+        rows.push_back(r);
+    }
+
+    for (auto it = newMaps.exact.begin(); it != newMaps.exact.end(); ++it) {
+        if (oldMaps.exact.contains(it.key()))
+            continue;
+        if (pairedNewExact.contains(it.key()))
+            continue;
+        ++added;
+        const Entry& newE = it.value();
+        Row r;
+        r.status = "Added";
+        r.assembly = newE.assembly;
+        r.typeFqn = newE.typeFqn;
+        r.kind = newE.kind;
+        r.item = kindToString(newE.kind) + "  " + newE.signature;
+        r.newOff = hex(newE.offset);
+        r.newRva = hex(newE.rva);
+        r.newVa  = hex(newE.va);
+        rows.push_back(r);
+    }
 
-                const QModelIndex idx0 = sourceModel()->index(source_row, 0, source_parent);
-                const bool hasChildren = sourceModel()->rowCount(idx0) > 0;
+    auto* dlg = new QDialog(this);
+    dlg->setAttribute(Qt::WA_DeleteOnClose);
+    dlg->setWindowTitle(QString("Diff (%1 changed, %2 added, %3 removed, %4 sig)").arg(changed).arg(added).arg(removed).arg(sigChanged));
+    dlg->resize(980, 640);
 
-                const bool filteringByStatus = !allowedStatuses.isEmpty();
-                const bool filteringByText = !text.trimmed().isEmpty();
-                bool selfOk = true;
+    auto* lay = new QVBoxLayout(dlg);
+    lay->setContentsMargins(12, 12, 12, 12);
+    lay->setSpacing(8);
 
-                const QString st = sourceModel()->index(source_row, 1, source_parent).data().toString();
-                if (!st.isEmpty() && !allowedStatuses.isEmpty()) {
-                    if (!allowedStatuses.contains(st))
-                        selfOk = false;
-                }
+    auto* filter = new QLineEdit(dlg);
+    filter->setPlaceholderText("Filter diff...");
+    lay->addWidget(filter);
+
+    auto* statusRow = new QHBoxLayout();
+    statusRow->setContentsMargins(0, 0, 0, 0);
+    statusRow->setSpacing(10);
+
+    auto* cbAdded = new QCheckBox("Added", dlg);
+    auto* cbChanged = new QCheckBox("Changed", dlg);
+    auto* cbRemoved = new QCheckBox("Removed", dlg);
+    auto* cbSig = new QCheckBox("Sig Changed", dlg);
+    cbAdded->setChecked(true);
+    cbChanged->setChecked(true);
+    cbRemoved->setChecked(true);
+    cbSig->setChecked(true);
+
+    statusRow->addWidget(cbAdded);
+    statusRow->addWidget(cbChanged);
+    statusRow->addWidget(cbRemoved);
+    statusRow->addWidget(cbSig);
+    statusRow->addStretch(1);
+
+    auto* exportJsonBtn = new QPushButton("Export JSON", dlg);
+    auto* exportCsvBtn  = new QPushButton("Export CSV", dlg);
+    statusRow->addWidget(exportJsonBtn);
+    statusRow->addWidget(exportCsvBtn);
+    lay->addLayout(statusRow);
+
+    class DiffFilterProxy final : public QSortFilterProxyModel {
+    public:
+        explicit DiffFilterProxy(QObject* parent = nullptr)
+            : QSortFilterProxyModel(parent) {}
+
+        QSet<QString> allowedStatuses;
+        QString text;
+
+    protected:
+        bool filterAcceptsRow(int source_row, const QModelIndex& source_parent) const override {
+            if (!sourceModel())
+                return true;
 
-                if (selfOk && !text.trimmed().isEmpty()) {
-                    QString blob;
-                    const int cols = sourceModel()->columnCount(source_parent);
-                    for (int c = 0; c < cols; ++c) {
-                        blob += sourceModel()->index(source_row, c, source_parent).data().toString();
-                        blob += "\n";
-                    }
-                    if (!blob.toLower().contains(text.trimmed().toLower()))
-                        selfOk = false;
-                }
+            const QModelIndex idx0 = sourceModel()->index(source_row, 0, source_parent);
+            const bool hasChildren = sourceModel()->rowCount(idx0) > 0;
 
-                if (hasChildren) {
-                    if (!filteringByStatus && !filteringByText)
-                        return true;
+            const bool filteringByStatus = !allowedStatuses.isEmpty();
+            const bool filteringByText = !text.trimmed().isEmpty();
+            bool selfOk = true;
 
-                    const int childCount = sourceModel()->rowCount(idx0);
-                    for (int i = 0; i < childCount; ++i) {
-                        if (filterAcceptsRow(i, idx0))
-                            return true;
-                    }
+            const QString st = sourceModel()->index(source_row, 1, source_parent).data().toString();
+            if (!st.isEmpty() && !allowedStatuses.isEmpty()) {
+                if (!allowedStatuses.contains(st))
+                    selfOk = false;
+            }
 
-                    if (filteringByText && selfOk)
-                        return true;
+            if (selfOk && !text.trimmed().isEmpty()) {
+                QString blob;
+                const int cols = sourceModel()->columnCount(source_parent);
+                for (int c = 0; c < cols; ++c) {
+                    blob += sourceModel()->index(source_row, c, source_parent).data().toString();
+                    blob += "\n";
+                }
+                if (!blob.toLower().contains(text.trimmed().toLower()))
+                    selfOk = false;
+            }
+
+            if (hasChildren) {
+                if (!filteringByStatus && !filteringByText)
+                    return true;
 
-                    return false;
+                const int childCount = sourceModel()->rowCount(idx0);
+                for (int i = 0; i < childCount; ++i) {
+                    if (filterAcceptsRow(i, idx0))
+                        return true;
                 }
 
-                return selfOk;
+                if (filteringByText && selfOk)
+                    return true;
+
+                return false;
             }
-        };
 
-        auto* model = new QStandardItemModel(dlg);
-        model->setHorizontalHeaderLabels({
-            "Item", "Status",
-            "Old Offset", "New Offset",
-            "Old RVA", "New RVA",
-            "Old VA", "New VA",
-            "Old Sig", "New Sig",
-            "Assembly", "Type"
-        });
+            return selfOk;
+        }
+    };
 
-        auto statusStyle = [](QStandardItem* statusItem, const QString& status) {
-            QColor statusColor(215, 246, 241);
-            QColor statusBg(11, 42, 45);
-            if (status == "Added") { statusColor = QColor(34, 255, 102); statusBg = QColor(15, 60, 40); }
-            else if (status == "Removed") { statusColor = QColor(255, 110, 110); statusBg = QColor(60, 20, 20); }
-            else if (status == "Changed") { statusColor = QColor(255, 200, 90); statusBg = QColor(55, 45, 20); }
-            else if (status == "Sig Changed") { statusColor = QColor(120, 200, 255); statusBg = QColor(20, 35, 60); }
-            statusItem->setForeground(QBrush(statusColor));
-            statusItem->setBackground(QBrush(statusBg));
-        };
+    auto* model = new QStandardItemModel(dlg);
+    model->setHorizontalHeaderLabels({
+        "Item", "Status",
+        "Old Offset", "New Offset",
+        "Old RVA", "New RVA",
+        "Old VA", "New VA",
+        "Old Sig", "New Sig",
+        "Assembly", "Type"
+    });
 
-        QMap<QString, QStandardItem*> asmNodes;
-        QMap<QString, QStandardItem*> typeNodes;
+    auto statusStyle = [](QStandardItem* statusItem, const QString& status) {
+        QColor statusColor(215, 246, 241);
+        QColor statusBg(11, 42, 45);
+        if (status == "Added") { statusColor = QColor(34, 255, 102); statusBg = QColor(15, 60, 40); }
+        else if (status == "Removed") { statusColor = QColor(255, 110, 110); statusBg = QColor(60, 20, 20); }
+        else if (status == "Changed") { statusColor = QColor(255, 200, 90); statusBg = QColor(55, 45, 20); }
+        else if (status == "Sig Changed") { statusColor = QColor(120, 200, 255); statusBg = QColor(20, 35, 60); }
+        statusItem->setForeground(QBrush(statusColor));
+        statusItem->setBackground(QBrush(statusBg));
+    };
 
-        for (const auto& r : rows) {
-            const QString asmKey = r.assembly;
-            QStandardItem* asmItem = asmNodes.value(asmKey, nullptr);
-            if (!asmItem) {
-                QList<QStandardItem*> rowItems;
-                rowItems << new QStandardItem(asmKey);
+    QMap<QString, QStandardItem*> asmNodes;
+    QMap<QString, QStandardItem*> typeNodes;
+
+    for (const auto& r : rows) {
+        const QString asmKey = r.assembly;
+        QStandardItem* asmItem = asmNodes.value(asmKey, nullptr);
+        if (!asmItem) {
+            QList<QStandardItem*> rowItems;
+            rowItems << new QStandardItem(asmKey);
+            rowItems << new QStandardItem();
+            for (int c = 2; c < model->columnCount(); ++c)
                 rowItems << new QStandardItem();
-                for (int c = 2; c < model->columnCount(); ++c)
-                    rowItems << new QStandardItem();
-                asmItem = rowItems[0];
-                asmItem->setIcon(icoFolder_);
-                model->appendRow(rowItems);
-                asmNodes.insert(asmKey, asmItem);
-            }
+            asmItem = rowItems[0];
+            asmItem->setIcon(icoFolder_);
+            model->appendRow(rowItems);
+            asmNodes.insert(asmKey, asmItem);
+        }
 
-            const QString typeKey = asmKey + "|" + r.typeFqn;
-            QStandardItem* typeItem = typeNodes.value(typeKey, nullptr);
-            if (!typeItem) {
-                QList<QStandardItem*> rowItems;
-                rowItems << new QStandardItem(r.typeFqn);
+        const QString typeKey = asmKey + "|" + r.typeFqn;
+        QStandardItem* typeItem = typeNodes.value(typeKey, nullptr);
+        if (!typeItem) {
+            QList<QStandardItem*> rowItems;
+            rowItems << new QStandardItem(r.typeFqn);
+            rowItems << new QStandardItem();
+            for (int c = 2; c < model->columnCount(); ++c)
                 rowItems << new QStandardItem();
-                for (int c = 2; c < model->columnCount(); ++c)
-                    rowItems << new QStandardItem();
-                typeItem = rowItems[0];
-                typeItem->setIcon(icoClass_);
-                asmItem->appendRow(rowItems);
-                typeNodes.insert(typeKey, typeItem);
-            }
+            typeItem = rowItems[0];
+            typeItem->setIcon(icoClass_);
+            asmItem->appendRow(rowItems);
+            typeNodes.insert(typeKey, typeItem);
+        }
 
-            QList<QStandardItem*> leaf;
-            auto* item0 = new QStandardItem(r.item);
-            const QIcon childIcon =
-                (r.kind == MemberKind::Ctor)     ? icoCtor_ :
-                (r.kind == MemberKind::Method)   ? icoMethod_ :
-                (r.kind == MemberKind::Field)    ? icoField_ :
-                (r.kind == MemberKind::Property) ? icoProperty_ :
-                (r.kind == MemberKind::Event)    ? icoEvent_ :
-                (r.kind == MemberKind::EnumValue)? icoEnumValue_ :
-                icoClass_;
-            item0->setIcon(childIcon);
-            leaf << item0;
-
-            auto* stItem = new QStandardItem(r.status);
-            statusStyle(stItem, r.status);
-            leaf << stItem;
-
-            leaf << new QStandardItem(r.oldOff);
-            leaf << new QStandardItem(r.newOff);
-            leaf << new QStandardItem(r.oldRva);
-            leaf << new QStandardItem(r.newRva);
-            leaf << new QStandardItem(r.oldVa);
-            leaf << new QStandardItem(r.newVa);
-            leaf << new QStandardItem(r.oldSig);
-            leaf << new QStandardItem(r.newSig);
-            leaf << new QStandardItem(r.assembly);
-            leaf << new QStandardItem(r.typeFqn);
-
-            typeItem->appendRow(leaf);
-        }
-
-        auto* proxy = new DiffFilterProxy(dlg);
-        proxy->setSourceModel(model);
-        proxy->setDynamicSortFilter(true);
-
-        auto* view = new QTreeView(dlg);
-        view->setModel(proxy);
-        view->setSelectionBehavior(QAbstractItemView::SelectRows);
-        view->setSelectionMode(QAbstractItemView::SingleSelection);
-        view->setSortingEnabled(true);
-        view->setRootIsDecorated(true);
-        view->setItemsExpandable(true);
-        view->setUniformRowHeights(true);
-        view->setHorizontalScrollBarPolicy(Qt::ScrollBarAsNeeded);
-        view->setHorizontalScrollMode(QAbstractItemView::ScrollPerPixel);
-        view->setItemDelegateForColumn(0, new SignatureHighlightDelegate(view));
-
-        view->header()->setStretchLastSection(false);
-        view->header()->setSectionResizeMode(QHeaderView::Interactive);
-        view->setColumnWidth(0, 700);
-        view->setColumnWidth(1, 110);
-        view->setColumnWidth(2, 110);
-        view->setColumnWidth(3, 110);
-        view->setColumnWidth(4, 110);
-        view->setColumnWidth(5, 110);
-        view->setColumnWidth(6, 140);
-        view->setColumnWidth(7, 140);
-        view->setColumnWidth(8, 260);
-        view->setColumnWidth(9, 260);
-        view->setColumnHidden(10, true);
-        view->setColumnHidden(11, true);
-        view->setColumnHidden(4, !showRvaVaCols);
-        view->setColumnHidden(5, !showRvaVaCols);
-        view->setColumnHidden(6, !showRvaVaCols);
-        view->setColumnHidden(7, !showRvaVaCols);
-        lay->addWidget(view, 1);
-
-        auto updateFilters = [proxy, cbAdded, cbChanged, cbRemoved, cbSig, filter]() {
-            QSet<QString> sts;
-            if (cbAdded->isChecked()) sts.insert("Added");
-            if (cbChanged->isChecked()) sts.insert("Changed");
-            if (cbRemoved->isChecked()) sts.insert("Removed");
-            if (cbSig->isChecked()) sts.insert("Sig Changed");
-            proxy->allowedStatuses = sts;
-            proxy->text = filter->text();
-            proxy->invalidate();
-        };
+        QList<QStandardItem*> leaf;
+        auto* item0 = new QStandardItem(r.item);
+        const QIcon childIcon =
+            (r.kind == MemberKind::Ctor)     ? icoCtor_ :
+            (r.kind == MemberKind::Method)   ? icoMethod_ :
+            (r.kind == MemberKind::Field)    ? icoField_ :
+            (r.kind == MemberKind::Property) ? icoProperty_ :
+            (r.kind == MemberKind::Event)    ? icoEvent_ :
+            (r.kind == MemberKind::EnumValue)? icoEnumValue_ :
+            icoClass_;
+        item0->setIcon(childIcon);
+        leaf << item0;
+
+        auto* stItem = new QStandardItem(r.status);
+        statusStyle(stItem, r.status);
+        leaf << stItem;
+
+        leaf << new QStandardItem(r.oldOff);
+        leaf << new QStandardItem(r.newOff);
+        leaf << new QStandardItem(r.oldRva);
+        leaf << new QStandardItem(r.newRva);
+        leaf << new QStandardItem(r.oldVa);
+        leaf << new QStandardItem(r.newVa);
+        leaf << new QStandardItem(r.oldSig);
+        leaf << new QStandardItem(r.newSig);
+        leaf << new QStandardItem(r.assembly);
+        leaf << new QStandardItem(r.typeFqn);
+
+        typeItem->appendRow(leaf);
+    }
 
-        connect(cbAdded, &QCheckBox::toggled, dlg, [updateFilters](bool) { updateFilters(); });
-        connect(cbChanged, &QCheckBox::toggled, dlg, [updateFilters](bool) { updateFilters(); });
-        connect(cbRemoved, &QCheckBox::toggled, dlg, [updateFilters](bool) { updateFilters(); });
-        connect(cbSig, &QCheckBox::toggled, dlg, [updateFilters](bool) { updateFilters(); });
-        connect(filter, &QLineEdit::textChanged, dlg, [updateFilters](const QString&) { updateFilters(); });
-        updateFilters();
-
-        auto collectVisibleLeaves = [proxy](auto&& self, const QModelIndex& parent) -> QVector<Row> {
-            QVector<Row> out;
-            const int rc = proxy->rowCount(parent);
-            for (int r = 0; r < rc; ++r) {
-                const QModelIndex idx0 = proxy->index(r, 0, parent);
-                if (!idx0.isValid())
-                    continue;
-                if (proxy->rowCount(idx0) > 0) {
-                    out += self(self, idx0);
-                    continue;
-                }
+    auto* proxy = new DiffFilterProxy(dlg);
+    proxy->setSourceModel(model);
+    proxy->setDynamicSortFilter(true);
+
+    auto* view = new QTreeView(dlg);
+    view->setModel(proxy);
+    view->setSelectionBehavior(QAbstractItemView::SelectRows);
+    view->setSelectionMode(QAbstractItemView::SingleSelection);
+    view->setSortingEnabled(true);
+    view->setRootIsDecorated(true);
+    view->setItemsExpandable(true);
+    view->setUniformRowHeights(true);
+    view->setHorizontalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+    view->setHorizontalScrollMode(QAbstractItemView::ScrollPerPixel);
+    view->setItemDelegateForColumn(0, new SignatureHighlightDelegate(view));
+
+    view->header()->setStretchLastSection(false);
+    view->header()->setSectionResizeMode(QHeaderView::Interactive);
+    view->setColumnWidth(0, 700);
+    view->setColumnWidth(1, 110);
+    view->setColumnWidth(2, 110);
+    view->setColumnWidth(3, 110);
+    view->setColumnWidth(4, 110);
+    view->setColumnWidth(5, 110);
+    view->setColumnWidth(6, 140);
+    view->setColumnWidth(7, 140);
+    view->setColumnWidth(8, 260);
+    view->setColumnWidth(9, 260);
+    view->setColumnHidden(10, true);
+    view->setColumnHidden(11, true);
+    view->setColumnHidden(4, !showRvaVaCols);
+    view->setColumnHidden(5, !showRvaVaCols);
+    view->setColumnHidden(6, !showRvaVaCols);
+    view->setColumnHidden(7, !showRvaVaCols);
+    lay->addWidget(view, 1);
+
+    auto updateFilters = [proxy, cbAdded, cbChanged, cbRemoved, cbSig, filter]() {
+        QSet<QString> sts;
+        if (cbAdded->isChecked()) sts.insert("Added");
+        if (cbChanged->isChecked()) sts.insert("Changed");
+        if (cbRemoved->isChecked()) sts.insert("Removed");
+        if (cbSig->isChecked()) sts.insert("Sig Changed");
+        proxy->allowedStatuses = sts;
+        proxy->text = filter->text();
+        proxy->invalidate();
+    };
 
-                Row row;
-                row.item = proxy->index(r, 0, parent).data().toString();
-                row.status = proxy->index(r, 1, parent).data().toString();
-                row.oldOff = proxy->index(r, 2, parent).data().toString();
-                row.newOff = proxy->index(r, 3, parent).data().toString();
-                row.oldRva = proxy->index(r, 4, parent).data().toString();
-                row.newRva = proxy->index(r, 5, parent).data().toString();
-                row.oldVa  = proxy->index(r, 6, parent).data().toString();
-                row.newVa  = proxy->index(r, 7, parent).data().toString();
-                row.oldSig = proxy->index(r, 8, parent).data().toString();
-                row.newSig = proxy->index(r, 9, parent).data().toString();
-                row.assembly = proxy->index(r, 10, parent).data().toString();
-                row.typeFqn  = proxy->index(r, 11, parent).data().toString();
-                out.push_back(row);
+    connect(cbAdded, &QCheckBox::toggled, dlg, [updateFilters](bool) { updateFilters(); });
+    connect(cbChanged, &QCheckBox::toggled, dlg, [updateFilters](bool) { updateFilters(); });
+    connect(cbRemoved, &QCheckBox::toggled, dlg, [updateFilters](bool) { updateFilters(); });
+    connect(cbSig, &QCheckBox::toggled, dlg, [updateFilters](bool) { updateFilters(); });
+    connect(filter, &QLineEdit::textChanged, dlg, [updateFilters](const QString&) { updateFilters(); });
+    updateFilters();
+
+    auto collectVisibleLeaves = [proxy](auto&& self, const QModelIndex& parent) -> QVector<Row> {
+        QVector<Row> out;
+        const int rc = proxy->rowCount(parent);
+        for (int r = 0; r < rc; ++r) {
+            const QModelIndex idx0 = proxy->index(r, 0, parent);
+            if (!idx0.isValid())
+                continue;
+            if (proxy->rowCount(idx0) > 0) {
+                out += self(self, idx0);
+                continue;
             }
-            return out;
-        };
 
-        connect(exportJsonBtn, &QPushButton::clicked, dlg, [dlg, collectVisibleLeaves]() {
-            const QString path = QFileDialog::getSaveFileName(dlg, "Export Diff (JSON)", {}, "JSON (*.json);;All files (*.*)");
-            if (path.isEmpty())
-                return;
+            Row row;
+            row.item = proxy->index(r, 0, parent).data().toString();
+            row.status = proxy->index(r, 1, parent).data().toString();
+            row.oldOff = proxy->index(r, 2, parent).data().toString();
+            row.newOff = proxy->index(r, 3, parent).data().toString();
+            row.oldRva = proxy->index(r, 4, parent).data().toString();
+            row.newRva = proxy->index(r, 5, parent).data().toString();
+            row.oldVa  = proxy->index(r, 6, parent).data().toString();
+            row.newVa  = proxy->index(r, 7, parent).data().toString();
+            row.oldSig = proxy->index(r, 8, parent).data().toString();
+            row.newSig = proxy->index(r, 9, parent).data().toString();
+            row.assembly = proxy->index(r, 10, parent).data().toString();
+            row.typeFqn  = proxy->index(r, 11, parent).data().toString();
+            out.push_back(row);
+        }
+        return out;
+    };
 
-            const QVector<Row> rows = collectVisibleLeaves(collectVisibleLeaves, {});
-            QJsonArray arr;
-            for (const auto& r : rows) {
-                QJsonObject o;
-                o.insert("status", r.status);
-                o.insert("assembly", r.assembly);
-                o.insert("type", r.typeFqn);
-                o.insert("item", r.item);
-                o.insert("oldOffset", r.oldOff);
-                o.insert("newOffset", r.newOff);
-                o.insert("oldRva", r.oldRva);
-                o.insert("newRva", r.newRva);
-                o.insert("oldVa", r.oldVa);
-                o.insert("newVa", r.newVa);
-                if (!r.oldSig.isEmpty() || !r.newSig.isEmpty()) {
-                    o.insert("oldSignature", r.oldSig);
-                    o.insert("newSignature", r.newSig);
-                }
-                arr.append(o);
-            }
-            QJsonObject root;
-            root.insert("diff", QJsonValue(arr));
+    connect(exportJsonBtn, &QPushButton::clicked, dlg, [dlg, collectVisibleLeaves]() {
+        const QString path = QFileDialog::getSaveFileName(dlg, "Export Diff (JSON)", {}, "JSON (*.json);;All files (*.*)");
+        if (path.isEmpty())
+            return;
 
-            QFile f(path);
-            if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate))
-                return;
-            f.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
-            f.close();
-        });
+        const QVector<Row> rows = collectVisibleLeaves(collectVisibleLeaves, {});
+        QJsonArray arr;
+        for (const auto& r : rows) {
+            QJsonObject o;
+            o.insert("status", r.status);
+            o.insert("assembly", r.assembly);
+            o.insert("type", r.typeFqn);
+            o.insert("item", r.item);
+            o.insert("oldOffset", r.oldOff);
+            o.insert("newOffset", r.newOff);
+            o.insert("oldRva", r.oldRva);
+            o.insert("newRva", r.newRva);
+            o.insert("oldVa", r.oldVa);
+            o.insert("newVa", r.newVa);
+            if (!r.oldSig.isEmpty() || !r.newSig.isEmpty()) {
+                o.insert("oldSignature", r.oldSig);
+                o.insert("newSignature", r.newSig);
+            }
+            arr.append(o);
+        }
+        QJsonObject root;
+        root.insert("diff", QJsonValue(arr));
 
-        connect(exportCsvBtn, &QPushButton::clicked, dlg, [dlg, collectVisibleLeaves]() {
-            const QString path = QFileDialog::getSaveFileName(dlg, "Export Diff (CSV)", {}, "CSV (*.csv);;All files (*.*)");
-            if (path.isEmpty())
-                return;
+        QFile f(path);
+        if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate))
+            return;
+        f.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+        f.close();
+    });
 
-            const QVector<Row> rows = collectVisibleLeaves(collectVisibleLeaves, {});
-            QFile f(path);
-            if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
-                return;
-            QTextStream ts(&f);
-            ts << "Status,Assembly,Type,Item,Old Offset,New Offset,Old RVA,New RVA,Old VA,New VA,Old Sig,New Sig\n";
-
-            auto esc = [](QString s) {
-                if (s.contains('"')) s.replace("\"", "\"\"");
-                const bool needs = s.contains(',') || s.contains('\n') || s.contains('\r') || s.contains('"');
-                if (needs) s = '"' + s + '"';
-                return s;
-            };
+    connect(exportCsvBtn, &QPushButton::clicked, dlg, [dlg, collectVisibleLeaves]() {
+        const QString path = QFileDialog::getSaveFileName(dlg, "Export Diff (CSV)", {}, "CSV (*.csv);;All files (*.*)");
+        if (path.isEmpty())
+            return;
 
-            for (const auto& r : rows) {
-                ts << esc(r.status) << ','
-                   << esc(r.assembly) << ','
-                   << esc(r.typeFqn) << ','
-                   << esc(r.item) << ','
-                   << esc(r.oldOff) << ','
-                   << esc(r.newOff) << ','
-                   << esc(r.oldRva) << ','
-                   << esc(r.newRva) << ','
-                   << esc(r.oldVa) << ','
-                   << esc(r.newVa) << ','
-                   << esc(r.oldSig) << ','
-                   << esc(r.newSig) << "\n";
-            }
-            f.close();
-        });
+        const QVector<Row> rows = collectVisibleLeaves(collectVisibleLeaves, {});
+        QFile f(path);
+        if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+            return;
+        QTextStream ts(&f);
+        ts << "Status,Assembly,Type,Item,Old Offset,New Offset,Old RVA,New RVA,Old VA,New VA,Old Sig,New Sig\n";
 
-        dlg->show();
+        auto esc = [](QString s) {
+            if (s.contains('"')) s.replace("\"", "\"\"");
+            const bool needs = s.contains(',') || s.contains('\n') || s.contains('\r') || s.contains('"');
+            if (needs) s = '"' + s + '"';
+            return s;
+        };
 
-        setBusy(false);
-        statusBar()->showMessage("Compared: " + basePath + " vs " + path, 4000);
+        for (const auto& r : rows) {
+            ts << esc(r.status) << ','
+               << esc(r.assembly) << ','
+               << esc(r.typeFqn) << ','
+               << esc(r.item) << ','
+               << esc(r.oldOff) << ','
+               << esc(r.newOff) << ','
+               << esc(r.oldRva) << ','
+               << esc(r.newRva) << ','
+               << esc(r.oldVa) << ','
+               << esc(r.newVa) << ','
+               << esc(r.oldSig) << ','
+               << esc(r.newSig) << "\n";
+        }
+        f.close();
     });
 
-    auto future = QtConcurrent::run([path]() {
-        return DumpCsParser::parse(path.toStdString());
-    });
-    cmpWatcher->setFuture(future);
+    dlg->show();
+
+    setBusy(false);
+    statusBar()->showMessage("Compared: " + basePath + " vs " + path, 4000);
+}
+
+void MainWindow::postBusyProgress(int percent) {
+    QMetaObject::invokeMethod(this, [this, percent]() {
+        if (busyBar_) busyBar_->setValue(percent);
+    }, Qt::QueuedConnection);
 }
 
 void MainWindow::startParseAsync(const QString& path) {
+    if (watcher_->isRunning()) {
+        pendingParsePath_ = path;
+        parseCancel_.cancel();
+        if (busyLabel_) busyLabel_->setText("Cancelling…");
+        return;
+    }
+
     parsePath_ = path;
     stack_->setCurrentWidget(explorerPage_);
 
+    fillCancel_.cancel();
+    ++fillGeneration_;
+    bodySource_.reset();
+    pendingCache_.reset();
+    pendingCompare_.reset();
+
     parseError_.clear();
+    parseFromCache_ = false;
 
     addRecentFile(path);
     refreshRecentUi();
 
     setBusy(true, "Parsing: " + path);
-
-    auto future = QtConcurrent::run([this, path]() {
+    if (busyBar_) busyBar_->setValue(0);
+    if (busyCancelBtn_) busyCancelBtn_->setVisible(true);
+    if (openBtn_) openBtn_->setEnabled(true);
+
+    dump_.clear();
+    symbols_.clear();
+    searchIndex_.reset();
+    lastSearch_.reset();
+    addressIndex_.reset();
+    resetTree();
+    if (tree_) tree_->setEnabled(true);
+
+    typeBatches_ = std::make_shared<TypeBatchQueue>();
+    typeBatchTimer_->start();
+    indexBuild_ = std::make_shared<SearchIndexBuild>();
+
+    parseCancel_ = CancellationToken{};
+    ParseOptions options;
+    options.progress = [this](int pct) { postBusyProgress(pct); };
+    options.cancel = parseCancel_;
+    options.deferSignatures = fileAtLeastSetting(path, "DeferSignaturesAboveMB", 512);
+    options.assemblies = loadAssemblyFilter();
+    // The helper always parses the whole dump; skeleton loads need the source in this process.
+    const QString helper = parseHelperPath();
+    options.skeleton = helper.isEmpty() && fileAtLeastSetting(path, "SkeletonAboveMB", 64);
+
+    auto future = QtConcurrent::run([this, path, cacheDir = modelCacheDir(), queue = typeBatches_, index = indexBuild_, options, helper]() mutable {
         try {
-            DumpCsParser::setProgressCallback([this](int pct) {
-                QMetaObject::invokeMethod(this, [this, pct]() {
-                    if (busyBar_) busyBar_->setValue(pct);
+            bool fromCache = false;
+            TypePreviewVisitor preview(queue);
+            SearchIndexVisitor indexer(*index);
+            TeeVisitor observer(preview, indexer);
+            options.observer = &observer;
+            options.timings = &index->timings;
+            DumpModel model = parseWithCache(path, cacheDir, &fromCache, options, helper, &index->cacheEntry);
+            // Skeleton models get theirs once the member fill completes.
+            if (!model.isSkeleton())
+                index->addresses.build(model);
+            // Queued rather than blocking, so closeEvent can wait for this task; posted before the task ends, they still
+            // run ahead of finishParseAsync.
+            if (fromCache) {
+                QMetaObject::invokeMethod(this, [this]() {
+                    parseFromCache_ = true;
+                    if (busyBar_) busyBar_->setValue(100);
                 }, Qt::QueuedConnection);
-            });
-
-            return DumpCsParser::parse(path.toStdString());
+            }
+            return model;
         } catch (const std::exception& ex) {
             const QString msg = QString::fromUtf8(ex.what());
             QMetaObject::invokeMethod(this, [this, msg]() {
                 parseError_ = msg;
-            }, Qt::BlockingQueuedConnection);
-            return std::vector<DumpType>{};
+            }, Qt::QueuedConnection);
+            return DumpModel{};
         } catch (...) {
             const QString msg = "Unknown error";
             QMetaObject::invokeMethod(this, [this, msg]() {
                 parseError_ = msg;
-            }, Qt::BlockingQueuedConnection);
-            return std::vector<DumpType>{};
+            }, Qt::QueuedConnection);
+            return DumpModel{};
         }
     });
     watcher_->setFuture(future);
 }
 
 void MainWindow::finishParseAsync() {
-    types_ = watcher_->result();
+    if (busyCancelBtn_) busyCancelBtn_->setVisible(false);
+
+    if (parseCancel_.isCancelled()) {
+        typeBatchTimer_->stop();
+        typeBatches_.reset();
+        resetTree();
+
+        const QString next = pendingParsePath_;
+        pendingParsePath_.clear();
+        if (!next.isEmpty()) {
+            startParseAsync(next);
+            return;
+        }
+
+        hasLoadedPrimary_ = false;
+        if (compareBtn_) compareBtn_->setVisible(false);
+        setBusy(false);
+        statusBar()->showMessage("Cancelled: " + parsePath_, 3000);
+        stack_->setCurrentWidget(welcomePage_);
+        return;
+    }
 
-    if (types_.empty() && !parseError_.isEmpty()) {
+    mergeTypeBatches();
+    typeBatchTimer_->stop();
+    typeBatches_.reset();
+
+    dump_ = watcher_->result();
+    symbols_.clear();
+    symbols_.reserve(dump_.strings.size());
+    for (SymbolId id = 0; id < (SymbolId)dump_.strings.size(); ++id)
+        symbols_.push_back(symbolText(dump_, id));
+
+    if (dump_.empty() && !parseError_.isEmpty()) {
         hasLoadedPrimary_ = false;
         if (compareBtn_) {
             compareBtn_->setVisible(false);
@@ -3208,66 +4584,280 @@ void MainWindow::finishParseAsync() {
     if (favoritesCount_) favoritesCount_->setText("0");
 
     hasLoadedPrimary_ = true;
+    const QFileInfo sourceInfo(parsePath_);
+    sourcePath_ = parsePath_;
+    sourceSize_ = sourceInfo.size();
+    sourceMtime_ = sourceInfo.lastModified().toMSecsSinceEpoch();
     if (compareBtn_) {
         compareBtn_->setVisible(true);
         compareBtn_->setEnabled(true);
     }
 
-    populateTree();
-    buildSearchIndex();
+    if (indexBuild_ && !dump_.isSkeleton())
+        addressIndex_ = std::make_shared<const AddressIndex>(std::move(indexBuild_->addresses));
+
+    adoptPreviewTree();
+    if (!adoptSearchIndex())
+        buildSearchIndex();
     updateSearchResults();
     setBusy(false);
 
-    statusBar()->showMessage("Loaded: " + parsePath_, 3000);
+    const QString filterNote = loadAssemblyFilter().empty() ? QString() : QString(" (assembly filter on)");
+    if (dump_.isSkeleton()) {
+        if (indexBuild_ && !indexBuild_->cacheEntry.file.empty())
+            pendingCache_ = std::make_shared<PendingCacheEntry>(std::move(indexBuild_->cacheEntry));
+        startMemberFill();
+        statusBar()->showMessage("Loaded types: " + parsePath_ + filterNote + " (members loading in background)", 3000);
+        return;
+    }
+    statusBar()->showMessage((parseFromCache_ ? "Loaded (cached): " : "Loaded: ") + parsePath_ + filterNote + stageTimingsText(), 6000);
 }
 
-void MainWindow::populateTree() {
+// Skeleton loads: a low-priority worker parses type bodies in file order and hands them over in batches;
+// anything the UI touches first is parsed on the spot by ensureTypeMembers.
+void MainWindow::startMemberFill() {
+    auto source = std::make_shared<MappedFile>();
+    if (!source->open(parsePath_.toStdString())) {
+        statusBar()->showMessage("Cannot reopen " + parsePath_ + ": members are unavailable", 6000);
+        return;
+    }
+    bodySource_ = source;
+
+    std::vector<SourceSpan> bodies(dump_.typeCount());
+    for (size_t i = 0; i < bodies.size(); ++i)
+        bodies[i] = dump_.typeBodySpan(i, source->size());
+
+    fillCancel_ = CancellationToken{};
+    const quint64 generation = fillGeneration_;
+    const bool deferSignatures = dump_.signaturesDeferred;
+    fillFuture_ = QtConcurrent::run([this, source, bodies = std::move(bodies), deferSignatures, cancel = fillCancel_, generation]() {
+        constexpr size_t kBatchTypes = 512;
+        using Batch = std::vector<std::pair<size_t, DumpModel>>;
+
+        QThread::currentThread()->setPriority(QThread::LowestPriority);
+        auto batch = std::make_shared<Batch>();
+        auto post = [&]() {
+            if (batch->empty())
+                return;
+            QMetaObject::invokeMethod(this, [this, generation, batch]() { applyMemberBatch(generation, *batch); }, Qt::QueuedConnection);
+            batch = std::make_shared<Batch>();
+        };
+
+        for (size_t i = 0; i < bodies.size() && !cancel.isCancelled(); ++i) {
+            batch->emplace_back(i, DumpCsParser::parseTypeBody(source->view(), bodies[i], deferSignatures));
+            if (batch->size() == kBatchTypes)
+                post();
+        }
+        if (!cancel.isCancelled())
+            post();
+        // Pool threads are reused.
+        QThread::currentThread()->setPriority(QThread::NormalPriority);
+    });
+}
+
+void MainWindow::applyMemberBatch(quint64 generation, const std::vector<std::pair<size_t, DumpModel>>& batch) {
+    if (generation != fillGeneration_ || !dump_.isSkeleton())
+        return;
+    for (const auto& [typeIndex, body] : batch)
+        dump_.adoptMembers(typeIndex, body);
+    afterMembersAdopted();
+}
+
+void MainWindow::ensureTypeMembers(int typeIndex) {
+    if (typeIndex < 0 || (size_t)typeIndex >= dump_.typeCount() || !dump_.membersPending((size_t)typeIndex) || !bodySource_)
+        return;
+    const SourceSpan body = dump_.typeBodySpan((size_t)typeIndex, bodySource_->size());
+    dump_.adoptMembers((size_t)typeIndex, DumpCsParser::parseTypeBody(bodySource_->view(), body, dump_.signaturesDeferred));
+    afterMembersAdopted();
+}
+
+// Called after adopting into a skeleton model; finishes the fill once no type is pending.
+void MainWindow::afterMembersAdopted() {
+    syncSymbols();
+    if (dump_.isSkeleton())
+        return;
+
+    fillCancel_.cancel();
+    bodySource_.reset();
+    if (pendingCache_) {
+        // The completed model is cached like any full parse, so the next open of this dump skips the skeleton phase.
+        cacheSaveFuture_ = QtConcurrent::run([model = dump_, entry = std::move(*pendingCache_), cacheDir = modelCacheDir()]() {
+            ModelCache::save(entry.file, entry.key, model);
+            ModelCache::prune(cacheDir.toStdString(), kKeepCachedModels);
+        });
+        pendingCache_.reset();
+    }
+    auto addresses = std::make_shared<AddressIndex>();
+    addresses->build(dump_);
+    addressIndex_ = std::move(addresses);
+    buildSearchIndex();
+    updateSearchResults();
+    statusBar()->showMessage("All members loaded: " + parsePath_, 3000);
+    if (pendingCompare_) {
+        const std::shared_ptr<PendingCompare> pending = std::move(pendingCompare_);
+        finishCompare(pending->other, pending->path);
+    }
+}
+
+void MainWindow::syncSymbols() {
+    for (SymbolId id = (SymbolId)symbols_.size(); id < (SymbolId)dump_.strings.size(); ++id)
+        symbols_.push_back(symbolText(dump_, id));
+}
+
+void MainWindow::resetTree() {
     model_->clear();
     model_->setHorizontalHeaderLabels({"Name"});
 
     nsItems_.clear();
     asmItems_.clear();
-    typeItems_.assign(types_.size(), nullptr);
-    asmRootItem_ = nullptr;
+    previewAsmItems_.clear();
+    previewNsItems_.clear();
+    pendingExpands_.clear();
+    typeItems_.clear();
 
-    auto* root = model_->invisibleRootItem();
     auto* asmRoot = new QStandardItem("Assemblies");
     asmRoot->setIcon(icoFolder_);
     asmRoot->setData("Assemblies", Qt::UserRole + 100);
-    root->appendRow(asmRoot);
+    model_->invisibleRootItem()->appendRow(asmRoot);
     asmRootItem_ = asmRoot;
+}
+
+QStandardItem* MainWindow::makeTypeItem(int typeIndex, const QString& assembly, const QString& ns, const QString& name, bool isEnum) {
+    auto* typeItem = new QStandardItem(name);
+    typeItem->setIcon(isEnum ? icoEnumType_ : icoClass_);
+    typeItem->setData(isEnum ? QString("#A06EFF") : QString("#50A0FF"), Qt::UserRole + 200);
+    typeItem->setForeground(isEnum ? QBrush(QColor(160, 110, 255)) : QBrush(QColor(80, 160, 255)));
+    typeItem->setData(typeIndex, Qt::UserRole + 1);
+    typeItem->setData("Type", Qt::UserRole + 2);
+    typeItem->setData(assembly + " :: " + ns + "::" + name, Qt::UserRole + 100);
+    typeItem->appendRow(new QStandardItem("Loading..."));
+    return typeItem;
+}
 
-    std::map<std::string, std::map<std::string, std::vector<int>>> asmNsMap;
-    for (size_t i = 0; i < types_.size(); ++i) {
-        const std::string asmName = types_[i].assembly.empty() ? std::string("(unknown)") : types_[i].assembly;
-        asmNsMap[asmName][types_[i].nameSpace].push_back((int)i);
+static QStandardItem* insertSortedChild(QStandardItem* parent, const QString& label, const QIcon& icon) {
+    int lo = 0;
+    int hi = parent->rowCount();
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (parent->child(mid)->text() < label)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    auto* item = new QStandardItem(label);
+    item->setIcon(icon);
+    item->setData(label, Qt::UserRole + 100);
+    parent->insertRow(lo, item);
+    return item;
+}
+
+void MainWindow::mergeTypeBatches() {
+    if (!typeBatches_ || !asmRootItem_)
+        return;
+
+    const bool firstBatch = typeItems_.empty();
+    QStandardItem* nsItem = nullptr;
+    QList<QStandardItem*> run;
+    auto flushRun = [&]() {
+        if (nsItem && !run.isEmpty())
+            nsItem->appendRows(run);
+        run.clear();
+    };
+
+    for (auto& batch : typeBatches_->takeAll()) {
+        for (const TypePreview& t : batch) {
+            const QString asmLabel = t.assembly.isEmpty() ? QString("(unknown)") : t.assembly;
+            auto nsIt = previewNsItems_.find({asmLabel, t.nameSpace});
+            if (nsIt == previewNsItems_.end()) {
+                auto asmIt = previewAsmItems_.find(asmLabel);
+                if (asmIt == previewAsmItems_.end())
+                    asmIt = previewAsmItems_.emplace(asmLabel, insertSortedChild(asmRootItem_, asmLabel, icoFolder_)).first;
+                nsIt = previewNsItems_.emplace(std::make_pair(asmLabel, t.nameSpace), insertSortedChild(asmIt->second, t.nameSpace, icoNamespace_)).first;
+            }
+            if (nsIt->second != nsItem) {
+                flushRun();
+                nsItem = nsIt->second;
+            }
+
+            auto* typeItem = makeTypeItem((int)typeItems_.size(), t.assembly, t.nameSpace, t.name, t.isEnum);
+            typeItems_.push_back(typeItem);
+            run.push_back(typeItem);
+        }
+    }
+    flushRun();
+
+    if (firstBatch && !typeItems_.empty())
+        tree_->expand(proxy_->mapFromSource(asmRootItem_->index()));
+}
+
+void MainWindow::adoptPreviewTree() {
+    if (typeItems_.size() != dump_.typeCount() || previewAsmItems_.empty()) {
+        populateTree();
+        return;
+    }
+
+    for (const auto& [label, item] : previewAsmItems_) {
+        SymbolId asmId = StringPool::kEmpty;
+        if (findSymbol(label, asmId))
+            asmItems_[asmId] = item;
+    }
+    for (const auto& [key, item] : previewNsItems_) {
+        SymbolId asmId = StringPool::kEmpty;
+        SymbolId nsId = StringPool::kEmpty;
+        if (findSymbol(key.first, asmId) && findSymbol(key.second, nsId))
+            nsItems_[{asmId, nsId}] = item;
+    }
+    previewAsmItems_.clear();
+    previewNsItems_.clear();
+
+    const auto expands = std::move(pendingExpands_);
+    pendingExpands_.clear();
+    for (const QPersistentModelIndex& idx : expands) {
+        if (idx.isValid())
+            onTreeExpanded(idx);
+    }
+}
+
+void MainWindow::populateTree() {
+    resetTree();
+    typeItems_.assign(dump_.typeCount(), nullptr);
+    auto* asmRoot = asmRootItem_;
+
+    auto bySymbolText = [this](SymbolId a, SymbolId b) {
+        return dump_.str(a) < dump_.str(b);
+    };
+    auto asmLabel = [this](SymbolId id) {
+        return id == StringPool::kEmpty ? std::string_view("(unknown)") : dump_.str(id);
+    };
+    auto byAsmLabel = [&](SymbolId a, SymbolId b) {
+        return asmLabel(a) < asmLabel(b);
+    };
+    using NsMap = std::map<SymbolId, std::vector<int>, decltype(bySymbolText)>;
+    std::map<SymbolId, NsMap, decltype(byAsmLabel)> asmNsMap(byAsmLabel);
+    for (size_t i = 0; i < dump_.typeCount(); ++i) {
+        const auto t = dump_.type(i);
+        asmNsMap.try_emplace(t.assembly(), bySymbolText).first->second[t.nameSpace()].push_back((int)i);
     }
 
-    for (auto& [asmName, nsMap] : asmNsMap) {
-        auto* asmItem = new QStandardItem(QString::fromStdString(asmName));
+    for (auto& [asmId, nsMap] : asmNsMap) {
+        const QString asmName = asmId == StringPool::kEmpty ? QString("(unknown)") : sym(asmId);
+        auto* asmItem = new QStandardItem(asmName);
         asmItem->setIcon(icoFolder_);
-        asmItem->setData(QString::fromStdString(asmName), Qt::UserRole + 100);
+        asmItem->setData(asmName, Qt::UserRole + 100);
         asmRoot->appendRow(asmItem);
-        asmItems_[asmName] = asmItem;
+        asmItems_[asmId] = asmItem;
 
-        for (auto& [ns, indices] : nsMap) {
-            auto* nsItem = new QStandardItem(QString::fromStdString(ns));
+        for (auto& [nsId, indices] : nsMap) {
+            auto* nsItem = new QStandardItem(sym(nsId));
             nsItem->setIcon(icoNamespace_);
-            nsItem->setData(QString::fromStdString(ns), Qt::UserRole + 100);
+            nsItem->setData(sym(nsId), Qt::UserRole + 100);
             asmItem->appendRow(nsItem);
 
-            nsItems_[asmName + "|" + ns] = nsItem;
+            nsItems_[{asmId, nsId}] = nsItem;
 
             for (int idx : indices) {
-                const bool isEnum = types_[idx].isEnum;
-                auto* typeItem = new QStandardItem(QString::fromStdString(types_[idx].name));
-                typeItem->setIcon(isEnum ? icoEnumType_ : icoClass_);
-                typeItem->setData(isEnum ? QString("#A06EFF") : QString("#50A0FF"), Qt::UserRole + 200);
-                typeItem->setForeground(isEnum ? QBrush(QColor(160, 110, 255)) : QBrush(QColor(80, 160, 255)));
-                typeItem->setData(idx, Qt::UserRole + 1);
-                typeItem->setData("Type", Qt::UserRole + 2);
-                typeItem->setData(QString::fromStdString(types_[idx].assembly + " :: " + types_[idx].nameSpace + "::" + types_[idx].name), Qt::UserRole + 100);
-                typeItem->appendRow(new QStandardItem("Loading..."));
+                const auto t = dump_.type((size_t)idx);
+                auto* typeItem = makeTypeItem(idx, sym(t.assembly()), sym(t.nameSpace()), sym(t.name()), t.isEnum());
                 nsItem->appendRow(typeItem);
 
                 if ((size_t)idx < typeItems_.size())
@@ -3293,16 +4883,23 @@ void MainWindow::onTreeExpanded(const QModelIndex& srcIdx) {
     }
     if (loadingRow < 0) return;
 
+    const bool isType = item->data(Qt::UserRole + 2).toString() == "Type";
+    if (isType && (size_t)item->data(Qt::UserRole + 1).toInt() >= dump_.typeCount()) {
+        pendingExpands_.push_back(QPersistentModelIndex(srcIdx));
+        return;
+    }
+
     item->removeRow(loadingRow);
 
-    if (item->data(Qt::UserRole + 2).toString() == "Type")
+    if (isType)
         buildTypeChildren(item, item->data(Qt::UserRole + 1).toInt());
     else
         buildGroupChildren(item);
 }
 
 void MainWindow::buildTypeChildren(QStandardItem* typeItem, int typeIndex) {
-    const bool isEnumType = types_[typeIndex].isEnum;
+    ensureTypeMembers(typeIndex);
+    const bool isEnumType = dump_.type(typeIndex).isEnum();
 
     bool hasCtor = false;
     bool hasMethod = false;
@@ -3311,8 +4908,8 @@ void MainWindow::buildTypeChildren(QStandardItem* typeItem, int typeIndex) {
     bool hasEvent = false;
     bool hasEnumValue = false;
 
-    for (const auto& m : types_[typeIndex].members) {
-        switch (m.kind) {
+    for (const auto m : dump_.type(typeIndex).members()) {
+        switch (m.kind()) {
         case MemberKind::Ctor:      hasCtor = true; break;
         case MemberKind::Method:    hasMethod = true; break;
         case MemberKind::Field:     hasField = true; break;
@@ -3363,7 +4960,7 @@ void MainWindow::buildTypeChildren(QStandardItem* typeItem, int typeIndex) {
 void MainWindow::buildGroupChildren(QStandardItem* groupItem) {
     const int typeIndex = groupItem->data(Qt::UserRole + 1).toInt();
     const QString groupKey = groupItem->data(Qt::UserRole + 3).toString();
-    const auto& members = types_[typeIndex].members;
+    const auto t = dump_.type((size_t)typeIndex);
 
     const QIcon childIcon =
         (groupKey == "ctor")     ? icoCtor_ :
@@ -3384,9 +4981,9 @@ void MainWindow::buildGroupChildren(QStandardItem* groupItem) {
     }
 
     bool any = groupItem->rowCount() > 0;
-    for (int mi = 0; mi < (int)members.size(); ++mi) {
-        const auto& m = members[(size_t)mi];
-        if (!groupMatches(m.kind, groupKey))
+    for (int mi = 0; mi < (int)t.memberCount(); ++mi) {
+        const auto m = t.member((size_t)mi);
+        if (!groupMatches(m.kind(), groupKey))
             continue;
 
         if (existing.contains(mi))
@@ -3394,17 +4991,17 @@ void MainWindow::buildGroupChildren(QStandardItem* groupItem) {
 
         any = true;
 
-        const QString display = QString::fromStdString(m.signature);
+        const QString display = viewText(m.signature());
 
-        const QString sig = QString::fromStdString(m.signature);
-        const QString rva = QString("0x%1").arg(QString::number((qulonglong)m.rva, 16));
-        const QString off = QString("0x%1").arg(QString::number((qulonglong)m.offset, 16));
-        const QString va  = QString("0x%1").arg(QString::number((qulonglong)m.va, 16));
+        const QString sig = viewText(m.signature());
+        const QString rva = QString("0x%1").arg(QString::number((qulonglong)m.rva(), 16));
+        const QString off = QString("0x%1").arg(QString::number((qulonglong)m.offset(), 16));
+        const QString va  = QString("0x%1").arg(QString::number((qulonglong)m.va(), 16));
 
         QString detail;
-        if (m.kind == MemberKind::Method || m.kind == MemberKind::Ctor) {
+        if (m.kind() == MemberKind::Method || m.kind() == MemberKind::Ctor) {
             detail = sig + "\n" + "RVA: " + rva + "  Offset: " + off + "  VA: " + va;
-        } else if (m.kind == MemberKind::Field || m.kind == MemberKind::Property || m.kind == MemberKind::Event) {
+        } else if (m.kind() == MemberKind::Field || m.kind() == MemberKind::Property || m.kind() == MemberKind::Event) {
             detail = sig + "\n" + "Offset: " + off;
         } else {
             detail = sig;
@@ -3420,7 +5017,7 @@ void MainWindow::buildGroupChildren(QStandardItem* groupItem) {
         it->setData(rva,    Qt::UserRole + 104);
         it->setData(mi,     Qt::UserRole + 10);
         it->setData(typeIndex, Qt::UserRole + 11);
-        it->setData((int)m.kind, Qt::UserRole + 12);
+        it->setData((int)m.kind(), Qt::UserRole + 12);
 
         groupItem->appendRow(it);
     }
@@ -4,10 +4,15 @@
 #include <QIcon>
 #include <QMap>
 #include <QSet>
+#include <QPersistentModelIndex>
+#include <QFuture>
 #include <vector>
+#include <atomic>
 #include <map>
+#include <memory>
 
 #include "parser/DumpCsParser.h"
+#include "search/AddressIndex.h"
 
 class QStackedWidget;
 class QTreeView;
@@ -28,6 +33,15 @@ class QTabWidget;
 class QComboBox;
 class QSplitter;
 class QCloseEvent;
+struct TypeBatchQueue;
+struct SearchIndexBuild;
+struct SearchEntry;
+struct SearchIndex;
+struct SearchResults;
+struct SearchRefinement;
+struct PendingCacheEntry;
+struct PendingCompare;
+class MappedFile;
 
 template <typename T> class QFutureWatcher;
 
@@ -43,6 +57,7 @@ protected:
 private slots:
     void openDumpCs();
     void compareDumpCs();
+    void finishCompare(const DumpModel& newModel, const QString& path);
     void onTreeExpanded(const QModelIndex& srcIdx);
 
 private:
@@ -53,33 +68,58 @@ private:
 
     void addRecentFile(const QString& path);
     void refreshRecentUi();
+    void editAssemblyFilter();
+    void refreshAssemblyFilterUi();
     void restoreUiState();
     void saveUiState();
 
+    void resetTree();
     void populateTree();
+    QStandardItem* makeTypeItem(int typeIndex, const QString& assembly, const QString& ns, const QString& name, bool isEnum);
+    void mergeTypeBatches();
+    void adoptPreviewTree();
     void buildTypeChildren(QStandardItem* typeItem, int typeIndex);
     void buildGroupChildren(QStandardItem* groupItem);
     void setupInteractions();
     void showContextMenu(const QPoint& p);
     void showSnippetDialog(int typeIndex, int memberIndex, const QString& templateName = QString());
     void updateDetailsPanel(const QModelIndex& srcIdx);
+    QString sourceText(const SourceSpan& span) const;
     QString buildSnippetText(int typeIndex, int memberIndex, const QString& templateName = QString()) const;
     void navigateToTypeOrMember(int typeIndex, int memberIndex, MemberKind memberKind);
     void copyTextToClipboard(const QString& text, const QString& statusMsg);
     void startParseAsync(const QString& path);
     void finishParseAsync();
+    void startMemberFill();
+    void applyMemberBatch(quint64 generation, const std::vector<std::pair<size_t, DumpModel>>& batch);
+    void ensureTypeMembers(int typeIndex);
+    void afterMembersAdopted();
+    void syncSymbols();
     void setBusy(bool busy, const QString& msg = {});
+    void postBusyProgress(int percent);
     void buildSearchIndex();
+    void appendNamespaceEntries(std::vector<SearchEntry>& entries) const;
+    QString searchDisplay(const SearchEntry& e) const;
+    QString searchDetail(const SearchEntry& e) const;
+    bool adoptSearchIndex();
+    QString stageTimingsText() const;
     void updateSearchResults();
     void navigateToSearchResult(QListWidgetItem* item);
+    QString addressSymbol(const AddressIndex::Hit& hit, uint64_t address) const;
+    void goToAddress();
+    void showSymbolicateDialog();
     QStackedWidget* stack_ = nullptr;
     QWidget* welcomePage_ = nullptr;
     QWidget* explorerPage_ = nullptr;
     class QPushButton* openBtn_ = nullptr;
     class QPushButton* compareBtn_ = nullptr;
     QListWidget* recentList_ = nullptr;
+    QLabel* assemblyFilterLabel_ = nullptr;
     QTreeView* tree_ = nullptr;
     QLineEdit* search_ = nullptr;
+    QLineEdit* gotoAddress_ = nullptr;
+    QComboBox* gotoAddressKind_ = nullptr;
+    class QPushButton* symbolicateBtn_ = nullptr;
     QTabWidget* detailsTabs_ = nullptr;
     QPlainTextEdit* detailsSummary_ = nullptr;
     QPlainTextEdit* detailsRaw_ = nullptr;
@@ -91,6 +131,7 @@ private:
     class QPushButton* exportCsvBtn_ = nullptr;
     QLineEdit* resultsSearch_ = nullptr;
     QComboBox* resultsScope_ = nullptr;
+    QCheckBox* resultsFuzzy_ = nullptr;
     QListWidget* favoritesList_ = nullptr;
     QLabel* favoritesCount_ = nullptr;
     QListWidget* resultsList_ = nullptr;
@@ -108,10 +149,26 @@ private:
     QWidget* busyRow_ = nullptr;
     QLabel* busyLabel_ = nullptr;
     QProgressBar* busyBar_ = nullptr;
-    QFutureWatcher<std::vector<DumpType>>* watcher_ = nullptr;
+    class QPushButton* busyCancelBtn_ = nullptr;
+    QFutureWatcher<DumpModel>* watcher_ = nullptr;
     QString parsePath_;
     QString parseError_;
+    bool parseFromCache_ = false;
+    QString pendingParsePath_;
+    CancellationToken parseCancel_;
+    std::shared_ptr<MappedFile> bodySource_;
+    CancellationToken fillCancel_;
+    QFuture<void> fillFuture_;
+    quint64 fillGeneration_ = 0;
+    std::shared_ptr<PendingCacheEntry> pendingCache_;
+    std::shared_ptr<PendingCompare> pendingCompare_;
+    QFuture<void> cacheSaveFuture_;
+    CancellationToken compareCancel_;
+    QFuture<void> compareFuture_;
     bool hasLoadedPrimary_ = false;
+    QString sourcePath_;
+    qint64 sourceSize_ = -1;
+    qint64 sourceMtime_ = -1;
 
     QIcon icoNamespace_;
     QIcon icoClass_;
@@ -124,30 +181,34 @@ private:
     QIcon icoEnumValue_;
     QIcon icoFolder_;
 
-    std::vector<DumpType> types_;
+    DumpModel dump_;
+    std::vector<QString> symbols_;
 
-    struct SearchEntry {
-        enum class Kind { Namespace, Type, Member } kind;
-        QString display;
-        QString detail;
-        QString assembly;
-        QString ns;
-        int typeIndex = -1;
-        int memberIndex = -1;
-        MemberKind memberKind = MemberKind::Method;
-    };
+    const QString& sym(SymbolId id) const;
+    bool findSymbol(const QString& text, SymbolId& out) const;
 
-    std::vector<SearchEntry> searchIndex_;
+    // Replaced as a whole on rebuilds; search workers keep the snapshot they started with.
+    std::shared_ptr<const SearchIndex> searchIndex_;
+    std::shared_ptr<const SearchRefinement> lastSearch_;
+    std::shared_ptr<const AddressIndex> addressIndex_;
     QStandardItem* asmRootItem_ = nullptr;
     std::vector<QStandardItem*> typeItems_;
-    std::map<std::string, QStandardItem*> asmItems_;
-    std::map<std::string, QStandardItem*> nsItems_;
+    std::map<SymbolId, QStandardItem*> asmItems_;
+    std::map<std::pair<SymbolId, SymbolId>, QStandardItem*> nsItems_;
+
+    std::shared_ptr<TypeBatchQueue> typeBatches_;
+    std::shared_ptr<SearchIndexBuild> indexBuild_;
+    QTimer* typeBatchTimer_ = nullptr;
+    std::map<QString, QStandardItem*> previewAsmItems_;
+    std::map<std::pair<QString, QString>, QStandardItem*> previewNsItems_;
+    std::vector<QPersistentModelIndex> pendingExpands_;
 
     QMap<QString, QString> snippetTemplates_;
     QString snippetDefaultTemplateName_;
 
-    QFutureWatcher<QVector<int>>* resultsFilterWatcher_ = nullptr;
-    int resultsFilterRequestId_ = 0;
+    QFutureWatcher<SearchResults>* resultsFilterWatcher_ = nullptr;
+    // Shared with search workers, which stop scanning once it moves past their request.
+    std::shared_ptr<std::atomic<int>> resultsFilterRequestId_ = std::make_shared<std::atomic<int>>(0);
 
     QSet<QString> favoriteKeys_;
 